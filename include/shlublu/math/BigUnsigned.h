@@ -0,0 +1,231 @@
+#pragma once
+
+/** @file
+	Arbitrary-precision unsigned integer.
+
+	See BigUnsigned class documentation for details.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <shlublu/math/Math.h>
+
+
+namespace shlublu
+{
+
+/**
+	Arbitrary-precision unsigned integer.
+	This type is intended for exact combinatorial counts that exceed 64 bits, such as \f$\binom{200}{20}\f$ or \f$100!\f$.
+
+	Values are stored as 32-bit limbs. Values up to 128 bits are stored inline and do not require any heap allocation. Multiplication switches from the
+	schoolbook algorithm to Karatsuba's one for large operands.
+
+	<b>Example</b>
+	@code
+	const BigUnsigned count(Math::binomial(BigUnsigned(200), BigUnsigned(20)));
+	std::cout << count << std::endl; // 1613587787967350073386147640
+	@endcode
+*/
+class BigUnsigned
+{
+public:
+	/**
+		Constructor.
+		@param value the initial value
+	*/
+	BigUnsigned(uint64_t value = 0);
+
+	/**
+		Constructor from a decimal representation.
+		@param decimal the decimal representation of the value, made of digits only
+		@exception std::invalid_argument if `decimal` is empty or contains a character that is not a digit
+	*/
+	explicit BigUnsigned(std::string const& decimal);
+
+	/**
+		Copy constructor.
+	*/
+	BigUnsigned(BigUnsigned const& other) = default;
+
+	/**
+		Move constructor.
+		`other` is left equal to zero.
+	*/
+	BigUnsigned(BigUnsigned&& other) noexcept;
+
+	/**
+		Copy assignment operator.
+	*/
+	BigUnsigned& operator=(BigUnsigned const& other) = default;
+
+	/**
+		Move assignment operator.
+		`other` is left equal to zero.
+	*/
+	BigUnsigned& operator=(BigUnsigned&& other) noexcept;
+
+public:
+	/**
+		Tells whether this value is zero.
+		@return `true` if this value is zero, `false` otherwise
+	*/
+	bool isZero() const;
+
+	/**
+		Returns the number of significant bits of this value.
+		@return the position of the most significant bit set plus one, or zero if this value is zero
+	*/
+	size_t bits() const;
+
+	/**
+		Tells whether this value can be converted to `uint64_t`.
+		@return `true` if this value is lower than \f$2^{64}\f$, `false` otherwise
+	*/
+	bool fitsUint64() const;
+
+	/**
+		Converts this value to `uint64_t`.
+		@return this value
+		@exception std::overflow_error if this value cannot be represented by `uint64_t`
+	*/
+	uint64_t toUint64() const;
+
+	/**
+		Returns the decimal representation of this value.
+		@return the decimal representation of this value
+	*/
+	std::string toString() const;
+
+	/**
+		Compares this value to another one.
+		@param other the value to compare to
+		@return a negative number if this value is lower than `other`, zero if they are equal, a positive number otherwise
+	*/
+	int compare(BigUnsigned const& other) const;
+
+	/**
+		Adds a value to this one.
+		@param other the value to add
+		@return a reference to this object
+	*/
+	BigUnsigned& operator+=(BigUnsigned const& other);
+
+	/**
+		Subtracts a value from this one.
+		@param other the value to subtract
+		@return a reference to this object
+		@exception std::domain_error if `other` is greater than this value
+	*/
+	BigUnsigned& operator-=(BigUnsigned const& other);
+
+	/**
+		Multiplies this value by another one.
+		@param other the value to multiply by
+		@return a reference to this object
+	*/
+	BigUnsigned& operator*=(BigUnsigned const& other);
+
+	/**
+		Divides this value by a 32-bit divisor.
+		This value is replaced by the quotient.
+		@param divisor the divisor
+		@return the remainder of the division
+		@exception std::domain_error if `divisor` is zero
+	*/
+	uint32_t divideBy(uint32_t divisor);
+
+private:
+	/// @cond INTERNAL
+
+	static constexpr size_t smallSize = 4;
+
+	uint32_t* data();
+	uint32_t const* data() const;
+
+	void resize(size_t size);
+	void trim();
+	void assign(std::vector<uint32_t>&& limbs);
+	void multiplyBy(uint32_t factor);
+
+	uint32_t mSmall[smallSize];
+	std::vector<uint32_t> mLarge; // used instead of mSmall when non-empty
+	size_t mSize;
+
+	/// @endcond
+};
+
+
+/**
+	Adds two values.
+	@param lhs left operand
+	@param rhs right operand
+	@return `lhs + rhs`
+*/
+BigUnsigned operator+(BigUnsigned lhs, BigUnsigned const& rhs);
+
+/**
+	Subtracts two values.
+	@param lhs left operand
+	@param rhs right operand
+	@return `lhs - rhs`
+	@exception std::domain_error if `rhs` is greater than `lhs`
+*/
+BigUnsigned operator-(BigUnsigned lhs, BigUnsigned const& rhs);
+
+/**
+	Multiplies two values.
+	@param lhs left operand
+	@param rhs right operand
+	@return `lhs * rhs`
+*/
+BigUnsigned operator*(BigUnsigned lhs, BigUnsigned const& rhs);
+
+/// @cond INTERNAL
+inline bool operator==(BigUnsigned const& lhs, BigUnsigned const& rhs) { return lhs.compare(rhs) == 0; }
+inline bool operator!=(BigUnsigned const& lhs, BigUnsigned const& rhs) { return lhs.compare(rhs) != 0; }
+inline bool operator<(BigUnsigned const& lhs, BigUnsigned const& rhs) { return lhs.compare(rhs) < 0; }
+inline bool operator<=(BigUnsigned const& lhs, BigUnsigned const& rhs) { return lhs.compare(rhs) <= 0; }
+inline bool operator>(BigUnsigned const& lhs, BigUnsigned const& rhs) { return lhs.compare(rhs) > 0; }
+inline bool operator>=(BigUnsigned const& lhs, BigUnsigned const& rhs) { return lhs.compare(rhs) >= 0; }
+/// @endcond
+
+/**
+	Writes the decimal representation of a value to a stream.
+	@param os the stream to write to
+	@param value the value to write
+	@return `os`
+*/
+std::ostream& operator<<(std::ostream& os, BigUnsigned const& value);
+
+
+namespace Math
+{
+	/**
+		Returns the exact factorial of a given number.
+		The product is computed by binary splitting, which takes advantage of Karatsuba multiplication.
+
+		@param n the number whose factorial is to be calculated
+		@return the factorial of `n`
+		@exception std::domain_error if `n` cannot be represented by `size_t`
+		@see factorial(T)
+	*/
+	template<> BigUnsigned factorial(BigUnsigned n);
+
+	/**
+		Returns the exact binomial coefficient \f$\binom{n}{k}\f$.
+
+		@param n the number of elements of the set
+		@param k the number of elements to choose
+		@return the binomial coefficient \f$\binom{n}{k}\f$, or zero if \f$k > n\f$
+		@exception std::domain_error if `n` cannot be represented by `size_t`
+		@see binomial(T, T)
+	*/
+	template<> BigUnsigned binomial(BigUnsigned n, BigUnsigned k);
+}
+
+}
@@ -1,196 +1,1637 @@
-#pragma once
-
-#include <algorithm>
-#include <vector>
-
-#include <shlublu/math/Math.h>
-#include <shlublu/text/String.h>
-
-/** @file
-	Combinatorics-oriented classes.
-
-	See classes documentation for details.
-*/
-
-
-namespace shlublu
-{
-
-
-class EnumerativeCombinatorics
-{
-public:
-	EnumerativeCombinatorics(size_t k)
-		: mK(k),
-		  mKUplet()
-	{
-		mKUplet.reserve(mK);
-	}
-
-	virtual ~EnumerativeCombinatorics()
-	{}
-
-	virtual size_t n() const = 0;
-	
-	size_t k() const
-	{
-		return mK;
-	}
-
-	virtual size_t number() const = 0;
-
-	std::vector<size_t> const& kUplet() const
-	{
-		return mKUplet;
-	}
-
-
-private:
-	friend class Arrangement;
-
-	void swapKUplet(std::vector<size_t>& swapWith)
-	{
-		mKUplet.swap(swapWith);
-	}
-
-	virtual bool next() = 0;
-
-protected:
-	const size_t mK;
-
-	std::vector<size_t> mKUplet;
-};
-
-
-class Combination : public EnumerativeCombinatorics
-{
-public:
-	Combination(size_t n, size_t k)
-		: EnumerativeCombinatorics(k),
-		  mN(n),
-		  mBitmask(k, 1), // K leading 1's
-		  mNextAvailable(k > 0)
-	{
-		if (mK > mN)
-		{
-			throw std::invalid_argument("Combinations<T>::Combinations(): k > n: " + shlublu::String::xtos(mK) + " > " + shlublu::String::xtos(mN));
-		}
-
-		mBitmask.resize(n, 0); // N-K trailing 0's
-	}
-
-
-	virtual ~Combination()
-	{}
-
-
-	virtual size_t n() const 
-	{ 
-		return mN; 
-	}
-
-
-	virtual size_t number() const
-	{
-		return number(mN, k());
-	}
-
-
-	virtual bool next()
-	{
-		const bool ret(mNextAvailable);
-
-		if (ret)
-		{
-			mKUplet.clear();
-
-			for (size_t i = 0; i < mN && mKUplet.size() < k(); ++i) // [0..N-1] integers
-			{
-				if (mBitmask[i])
-				{
-					mKUplet.push_back(i);
-				}
-			}
-
-			mNextAvailable = std::prev_permutation(mBitmask.begin(), mBitmask.end());
-		}
-
-		return ret;
-	}
-
-
-	static size_t number(size_t n, size_t k)
-	{
-		return (shlublu::Math::factorial(n) / shlublu::Math::factorial(n - k)) / shlublu::Math::factorial(k);
-	}
-
-
-private:
-	const size_t mN;
-
-	std::string mBitmask;
-	bool mNextAvailable;
-};
-
-
-class Arrangement : public EnumerativeCombinatorics
-{
-public:
-	Arrangement(size_t n, size_t k)
-		:  EnumerativeCombinatorics(k),
-		   mCombinations(n, k),
-		   mStarted(false)
-	{}
-
-
-	virtual ~Arrangement()
-	{}
-
-
-	virtual bool next()
-	{
-		bool ret(mStarted);
-
-		if (ret)
-		{
-			ret = std::next_permutation(mKUplet.begin(), mKUplet.end());
-		}
-
-		if (!ret)
-		{
-			mStarted = true;
-
-			mCombinations.swapKUplet(mKUplet);
-			ret = mCombinations.next();
-			mCombinations.swapKUplet(mKUplet);
-		}
-
-		return ret;
-	}
-
-
-	virtual size_t n() const 
-	{ 
-		return mCombinations.n(); 
-	}
-
-
-	virtual size_t number() const
-	{
-		return number(n(), k());
-	}
-
-
-	static size_t number(size_t n, size_t k)
-	{
-		return shlublu::Math::factorial(n) / shlublu::Math::factorial(n - k);
-	}
-
-
-private:
-	Combination mCombinations;
-	bool mStarted;
-};
-
-
-}
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <shlublu/math/BigUnsigned.h>
+#include <shlublu/math/Math.h>
+#include <shlublu/random/Random.h>
+#include <shlublu/text/String.h>
+
+/** @file
+	Combinatorics-oriented classes.
+
+	See classes documentation for details.
+*/
+
+
+namespace shlublu
+{
+
+
+class EnumerativeCombinatorics
+{
+public:
+	EnumerativeCombinatorics(size_t k)
+		: mK(k),
+		  mKUplet()
+	{
+		mKUplet.reserve(mK);
+	}
+
+	virtual ~EnumerativeCombinatorics()
+	{}
+
+	virtual size_t n() const = 0;
+	
+	size_t k() const
+	{
+		return mK;
+	}
+
+	virtual size_t number() const = 0;
+
+	std::vector<size_t> const& kUplet() const
+	{
+		return mKUplet;
+	}
+
+	// Writes the next k-uplets to buffer, one row of k elements after the other, and returns how many were written (at most maxCount)
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount) = 0;
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount) = 0;
+
+
+private:
+	friend class Arrangement;
+
+	void swapKUplet(std::vector<size_t>& swapWith)
+	{
+		mKUplet.swap(swapWith);
+	}
+
+	virtual bool next() = 0;
+
+protected:
+	// Steps with ENUMERATOR::next() so that this loop is not a virtual call per k-uplet
+	template<typename ENUMERATOR, typename T> static size_t fillBatch(ENUMERATOR& enumerator, T* buffer, size_t maxCount, const char* caller)
+	{
+		if (enumerator.n() > 0 && enumerator.n() - 1 > size_t(std::numeric_limits<T>::max()))
+		{
+			throw std::invalid_argument(std::string(caller) + ": elements up to " + shlublu::String::xtos(enumerator.n() - 1) + " do not fit in the buffer type");
+		}
+
+		const size_t k(enumerator.mK);
+		size_t ret(0);
+
+		for (T* row = buffer; ret < maxCount && enumerator.ENUMERATOR::next(); ++ret, row += k)
+		{
+			// Local copies: stores to the buffer may alias the members, which would otherwise be reloaded after each of them
+			size_t const* const kUplet(enumerator.mKUplet.data());
+
+			for (size_t i = 0; i < k; ++i)
+			{
+				row[i] = T(kUplet[i]);
+			}
+		}
+
+		return ret;
+	}
+
+	const size_t mK;
+
+	std::vector<size_t> mKUplet;
+};
+
+
+/// @cond INTERNAL
+
+// Splits the enumeration into balanced ranges of consecutive indexes, each of them being walked by its own enumerator in its own thread
+template<typename ENUMERATOR, typename FUNCTION> void __parallelForEach(size_t n, size_t k, size_t threads, FUNCTION const& callback, const char* caller)
+{
+	if (threads == 0)
+	{
+		throw std::invalid_argument(std::string(caller) + ": threads should not be zero");
+	}
+
+	const size_t total(ENUMERATOR::number(n, k));
+	const size_t ranges(std::max<size_t>(1, std::min(threads, total)));
+
+	std::vector<std::exception_ptr> errors(ranges);
+	std::vector<std::thread> workers;
+
+	const auto walk([n, k, total, ranges, &callback, &errors](size_t range)
+	{
+		try
+		{
+			const size_t begin(total / ranges * range + std::min(range, total % ranges));
+			const size_t count(total / ranges + (range < total % ranges));
+
+			ENUMERATOR enumerator(n, k);
+
+			if (count > 0)
+			{
+				enumerator.seek(begin);
+			}
+
+			for (size_t i = 0; i < count && enumerator.next(); ++i)
+			{
+				callback(enumerator.kUplet());
+			}
+		}
+		catch (...)
+		{
+			errors[range] = std::current_exception();
+		}
+	});
+
+	workers.reserve(ranges - 1);
+
+	for (size_t range = 1; range < ranges; ++range)
+	{
+		workers.emplace_back(walk, range);
+	}
+
+	walk(0);
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	for (const auto& error : errors)
+	{
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+
+// Floyd's algorithm: k distinct integers uniformly drawn from [0..N-1] in O(k) expected time, whatever N is. Their order is not uniform.
+inline std::vector<size_t> __randomDistinct(size_t n, size_t k)
+{
+	std::vector<size_t> ret;
+	std::unordered_set<size_t> drawn;
+
+	ret.reserve(k);
+	drawn.reserve(k);
+
+	for (size_t j = n - k; j < n; ++j)
+	{
+		// j cannot have been drawn yet: it takes the place of the candidate when the latter already was
+		const size_t candidate(shlublu::Random::random<size_t>(0, j));
+		const size_t element(drawn.count(candidate) ? j : candidate);
+
+		drawn.insert(element);
+		ret.push_back(element);
+	}
+
+	return ret;
+}
+
+
+// Distinct k-uplets drawn by unranking distinct random positions, returned in the order of the enumeration
+template<typename ENUMERATOR> std::vector<std::vector<size_t>> __randomKUplets(ENUMERATOR const& enumerator, size_t count, const char* caller)
+{
+	const size_t total(enumerator.number());
+
+	if (count > total)
+	{
+		throw std::invalid_argument(std::string(caller) + ": count > number: " + shlublu::String::xtos(count) + " > " + shlublu::String::xtos(total));
+	}
+
+	auto ranks(__randomDistinct(total, count));
+	std::vector<std::vector<size_t>> ret;
+
+	std::sort(ranks.begin(), ranks.end());
+	ret.reserve(count);
+
+	for (const auto& rank : ranks)
+	{
+		ret.push_back(enumerator.unrank(rank));
+	}
+
+	return ret;
+}
+
+/// @endcond
+
+
+class Combination : public EnumerativeCombinatorics
+{
+public:
+	Combination(size_t n, size_t k)
+		: EnumerativeCombinatorics(k),
+		  mN(n),
+		  mStarted(false),
+		  mNextAvailable(k > 0)
+	{
+		if (mK > mN)
+		{
+			throw std::invalid_argument("Combinations<T>::Combinations(): k > n: " + shlublu::String::xtos(mK) + " > " + shlublu::String::xtos(mN));
+		}
+	}
+
+
+	virtual ~Combination()
+	{}
+
+
+	virtual size_t n() const 
+	{ 
+		return mN; 
+	}
+
+
+	virtual size_t number() const
+	{
+		return number(mN, k());
+	}
+
+
+	// Lexicographic order, in constant amortized time: only the elements that follow the one being increased are rewritten
+	virtual bool next()
+	{
+		const bool ret(mNextAvailable);
+
+		if (ret)
+		{
+			if (mStarted)
+			{
+				size_t i(mK - 1);
+
+				while (mKUplet[i] == mN - mK + i) // already at its maximum
+				{
+					--i;
+				}
+
+				++mKUplet[i];
+
+				for (++i; i < mK; ++i)
+				{
+					mKUplet[i] = mKUplet[i - 1] + 1;
+				}
+			}
+			else
+			{
+				mStarted = true;
+
+				if (mKUplet.size() != mK) // otherwise set by seek()
+				{
+					mKUplet.resize(mK);
+					std::iota(mKUplet.begin(), mKUplet.end(), size_t(0));
+				}
+			}
+
+			mNextAvailable = (mKUplet.front() != mN - mK); // [N-K..N-1] is the last one
+		}
+
+		return ret;
+	}
+
+
+	// Position of a k-uplet in the enumeration, based on the combinatorial number system
+	size_t rank(std::vector<size_t> const& kUplet) const
+	{
+		if (kUplet.size() != mK || (mK > 0 && kUplet.back() >= mN) || std::adjacent_find(kUplet.begin(), kUplet.end(), std::greater_equal<size_t>()) != kUplet.end())
+		{
+			throw std::invalid_argument("Combination::rank(): kUplet should be " + shlublu::String::xtos(mK) + " increasing integers lower than " + shlublu::String::xtos(mN));
+		}
+
+		// The dual of [a0..aK-1] is [N-1-a0..N-1-aK-1], whose position in the reverse enumeration is its combinadic
+		size_t combinadic(0);
+
+		for (size_t i = 0; i < mK; ++i)
+		{
+			combinadic += shlublu::Math::binomial(mN - 1 - kUplet[i], mK - i);
+		}
+
+		return number() - 1 - combinadic;
+	}
+
+
+	// k-uplet at a given position of the enumeration, in O(k^2 log(n))
+	std::vector<size_t> unrank(size_t index) const
+	{
+		const size_t total(number());
+
+		if (index >= total)
+		{
+			throw std::out_of_range("Combination::unrank(): index is out of range: " + shlublu::String::xtos(index) + " >= " + shlublu::String::xtos(total));
+		}
+
+		std::vector<size_t> ret(mK);
+		size_t combinadic(total - 1 - index);
+		size_t upperBound(mN);
+
+		for (size_t i = 0; i < mK; ++i)
+		{
+			const size_t r(mK - i);
+
+			// Greatest c < upperBound such as binomial(c, r) <= combinadic. binomial(r - 1, r) is zero.
+			size_t low(r - 1);
+			size_t high(upperBound - 1);
+
+			while (low < high)
+			{
+				const size_t middle(low + (high - low + 1) / 2);
+
+				if (shlublu::Math::binomial(middle, r) <= combinadic)
+				{
+					low = middle;
+				}
+				else
+				{
+					high = middle - 1;
+				}
+			}
+
+			combinadic -= shlublu::Math::binomial(low, r);
+			ret[i] = mN - 1 - low;
+			upperBound = low;
+		}
+
+		return ret;
+	}
+
+
+	// The next call to next() goes to the k-uplet at this position
+	void seek(size_t index)
+	{
+		mKUplet = unrank(index);
+		mStarted = false;
+		mNextAvailable = (mK > 0);
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "Combination::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "Combination::nextBatch()");
+	}
+
+
+	// Calls callback(kUplet) for each k-uplet, from several threads at once. Each thread walks its own range of the enumeration.
+	template<typename FUNCTION> void parallelForEach(size_t threads, FUNCTION const& callback) const
+	{
+		__parallelForEach<Combination>(mN, mK, threads, callback, "Combination::parallelForEach()");
+	}
+
+
+	// Uniformly distributed k-uplet, drawn without enumerating: suitable for Monte Carlo estimates over spaces of any size
+	std::vector<size_t> random() const
+	{
+		auto ret(__randomDistinct(mN, mK));
+
+		std::sort(ret.begin(), ret.end());
+
+		return ret;
+	}
+
+
+	// count distinct uniformly distributed k-uplets, in the order of the enumeration. number() should fit in size_t.
+	std::vector<std::vector<size_t>> random(size_t count) const
+	{
+		return __randomKUplets(*this, count, "Combination::random()");
+	}
+
+
+	static size_t number(size_t n, size_t k)
+	{
+		return shlublu::Math::binomial(n, k);
+	}
+
+
+	// Exact count for large n, for example number<BigUnsigned>(200, 20)
+	template<typename T> static T number(size_t n, size_t k)
+	{
+		return shlublu::Math::binomial(T(n), T(k));
+	}
+
+
+private:
+	const size_t mN;
+
+	bool mStarted;
+	bool mNextAvailable;
+};
+
+
+class Arrangement : public EnumerativeCombinatorics
+{
+public:
+	Arrangement(size_t n, size_t k)
+		:  EnumerativeCombinatorics(k),
+		   mCombinations(n, k),
+		   mStarted(false),
+		   mSought(false)
+	{}
+
+
+	virtual ~Arrangement()
+	{}
+
+
+	virtual bool next()
+	{
+		if (mSought) // the k-uplet set by seek() comes first
+		{
+			mSought = false;
+			return true;
+		}
+
+		bool ret(mStarted);
+
+		if (ret)
+		{
+			ret = std::next_permutation(mKUplet.begin(), mKUplet.end());
+		}
+
+		if (!ret)
+		{
+			mCombinations.swapKUplet(mKUplet);
+			ret = mCombinations.next();
+			mCombinations.swapKUplet(mKUplet);
+
+			mStarted = ret; // once the combinations are exhausted, the last one is not permuted again
+		}
+
+		return ret;
+	}
+
+
+	virtual size_t n() const 
+	{ 
+		return mCombinations.n(); 
+	}
+
+
+	virtual size_t number() const
+	{
+		return number(n(), k());
+	}
+
+
+	// Position of a k-uplet in the enumeration: rank of its combination, then Lehmer code of its ordering
+	size_t rank(std::vector<size_t> const& kUplet) const
+	{
+		std::vector<size_t> sorted(kUplet);
+		std::sort(sorted.begin(), sorted.end());
+
+		if (sorted.size() != k() || (k() > 0 && sorted.back() >= n()) || std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+		{
+			throw std::invalid_argument("Arrangement::rank(): kUplet should be " + shlublu::String::xtos(k()) + " distinct integers lower than " + shlublu::String::xtos(n()));
+		}
+
+		size_t lehmer(0);
+
+		for (size_t i = 0; i < k(); ++i)
+		{
+			const auto smallerAfter(std::count_if(kUplet.begin() + i + 1, kUplet.end(), [&kUplet, i](size_t x) { return x < kUplet[i]; }));
+			lehmer += size_t(smallerAfter) * shlublu::Math::factorial(k() - 1 - i);
+		}
+
+		return mCombinations.rank(sorted) * shlublu::Math::factorial(k()) + lehmer;
+	}
+
+
+	// k-uplet at a given position of the enumeration, in O(k^2 log(n))
+	std::vector<size_t> unrank(size_t index) const
+	{
+		const size_t total(number());
+
+		if (index >= total)
+		{
+			throw std::out_of_range("Arrangement::unrank(): index is out of range: " + shlublu::String::xtos(index) + " >= " + shlublu::String::xtos(total));
+		}
+
+		const size_t orderings(shlublu::Math::factorial(k()));
+		std::vector<size_t> remaining(mCombinations.unrank(index / orderings));
+		std::vector<size_t> ret;
+		size_t lehmer(index % orderings);
+
+		ret.reserve(k());
+
+		for (size_t i = 0; i < k(); ++i)
+		{
+			const size_t weight(shlublu::Math::factorial(k() - 1 - i));
+			const auto chosen(remaining.begin() + lehmer / weight);
+
+			ret.push_back(*chosen);
+			remaining.erase(chosen);
+			lehmer %= weight;
+		}
+
+		return ret;
+	}
+
+
+	// The next call to next() goes to the k-uplet at this position
+	void seek(size_t index)
+	{
+		mKUplet = unrank(index);
+
+		mCombinations.seek(index / shlublu::Math::factorial(k()));
+		mCombinations.next();
+
+		mStarted = true;
+		mSought = (k() > 0);
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "Arrangement::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "Arrangement::nextBatch()");
+	}
+
+
+	// Calls callback(kUplet) for each k-uplet, from several threads at once. Each thread walks its own range of the enumeration.
+	template<typename FUNCTION> void parallelForEach(size_t threads, FUNCTION const& callback) const
+	{
+		__parallelForEach<Arrangement>(n(), k(), threads, callback, "Arrangement::parallelForEach()");
+	}
+
+
+	// Uniformly distributed k-uplet, drawn without enumerating: a uniform combination in a uniform order (Fisher-Yates shuffle)
+	std::vector<size_t> random() const
+	{
+		auto ret(__randomDistinct(n(), k()));
+
+		for (size_t i = ret.size(); i > 1; --i)
+		{
+			std::swap(ret[i - 1], ret[shlublu::Random::random<size_t>(0, i - 1)]);
+		}
+
+		return ret;
+	}
+
+
+	// count distinct uniformly distributed k-uplets, in the order of the enumeration. number() should fit in size_t.
+	std::vector<std::vector<size_t>> random(size_t count) const
+	{
+		return __randomKUplets(*this, count, "Arrangement::random()");
+	}
+
+
+	static size_t number(size_t n, size_t k)
+	{
+		return (k > n) ? 0 : shlublu::Math::__multiplyChecked(Combination::number(n, k), shlublu::Math::factorial(k), "Arrangement::number()");
+	}
+
+
+	// Exact count for large n, for example number<BigUnsigned>(200, 20)
+	template<typename T> static T number(size_t n, size_t k)
+	{
+		return (k > n) ? T(0) : Combination::number<T>(n, k) * shlublu::Math::factorial(T(k));
+	}
+
+
+private:
+	Combination mCombinations;
+	bool mStarted;
+	bool mSought;
+};
+
+
+
+// All the orderings of [0..N-1] by Heap's algorithm: each of them is obtained by swapping two elements of the previous one, in constant amortized time
+class Permutation : public EnumerativeCombinatorics
+{
+public:
+	explicit Permutation(size_t n)
+		: EnumerativeCombinatorics(n),
+		  mCounters(n, 0),
+		  mLevel(1),
+		  mSwapped(0, 0),
+		  mStarted(false)
+	{}
+
+
+	virtual ~Permutation()
+	{}
+
+
+	virtual size_t n() const
+	{
+		return mK;
+	}
+
+
+	virtual size_t number() const
+	{
+		return number(mK);
+	}
+
+
+	virtual bool next()
+	{
+		bool ret(false);
+
+		if (mStarted)
+		{
+			while (!ret && mLevel < mK)
+			{
+				if (mCounters[mLevel] < mLevel)
+				{
+					mSwapped = std::make_pair((mLevel % 2 == 0) ? size_t(0) : mCounters[mLevel], mLevel);
+					std::swap(mKUplet[mSwapped.first], mKUplet[mSwapped.second]);
+
+					++mCounters[mLevel];
+					mLevel = 1;
+					ret = true;
+				}
+				else
+				{
+					mCounters[mLevel] = 0;
+					++mLevel;
+				}
+			}
+		}
+		else
+		{
+			mStarted = true;
+
+			mKUplet.resize(mK);
+			std::iota(mKUplet.begin(), mKUplet.end(), size_t(0));
+
+			ret = (mK > 0);
+		}
+
+		return ret;
+	}
+
+
+	// Positions whose elements have been exchanged by the last call to next(). (0, 0) for the first permutation, which is the identity.
+	std::pair<size_t, size_t> const& swapped() const
+	{
+		return mSwapped;
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "Permutation::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "Permutation::nextBatch()");
+	}
+
+
+	static size_t number(size_t n)
+	{
+		return shlublu::Math::factorial(n);
+	}
+
+
+private:
+	std::vector<size_t> mCounters; // Heap's algorithm state: mCounters[i] swaps have been done at level i since it was entered
+	size_t mLevel;
+	std::pair<size_t, size_t> mSwapped;
+	bool mStarted;
+};
+
+// Combinations with repetition: non-decreasing k-uplets of [0..N-1] in lexicographic order, in constant amortized time. k may exceed n.
+class MultisetCombination : public EnumerativeCombinatorics
+{
+public:
+	MultisetCombination(size_t n, size_t k)
+		: EnumerativeCombinatorics(k),
+		  mN(n),
+		  mStarted(false)
+	{}
+
+
+	virtual ~MultisetCombination()
+	{}
+
+
+	virtual size_t n() const
+	{
+		return mN;
+	}
+
+
+	virtual size_t number() const
+	{
+		return number(mN, mK);
+	}
+
+
+	virtual bool next()
+	{
+		bool ret(false);
+
+		if (mStarted)
+		{
+			// Rightmost element that can be increased: those following it restart from its new value
+			size_t i(mKUplet.size());
+
+			while (i > 0 && mKUplet[i - 1] == mN - 1)
+			{
+				--i;
+			}
+
+			if (i > 0)
+			{
+				std::fill(mKUplet.begin() + (i - 1), mKUplet.end(), mKUplet[i - 1] + 1);
+				ret = true;
+			}
+		}
+		else
+		{
+			mStarted = true;
+
+			if (mK > 0 && mN > 0)
+			{
+				mKUplet.assign(mK, 0);
+				ret = true;
+			}
+		}
+
+		return ret;
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "MultisetCombination::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "MultisetCombination::nextBatch()");
+	}
+
+
+	static size_t number(size_t n, size_t k)
+	{
+		return (n == 0) ? size_t(k == 0) : shlublu::Math::binomial(n + k - 1, k);
+	}
+
+
+private:
+	const size_t mN;
+
+	bool mStarted;
+};
+
+
+// Distinct orderings of a multiset in lexicographic order, in constant amortized time: element i appears multiplicities[i] times,
+// and orderings that only differ by exchanging equal elements are enumerated once.
+class MultisetPermutation : public EnumerativeCombinatorics
+{
+public:
+	explicit MultisetPermutation(std::vector<size_t> const& multiplicities)
+		: EnumerativeCombinatorics(std::accumulate(multiplicities.begin(), multiplicities.end(), size_t(0))),
+		  mMultiplicities(multiplicities),
+		  mStarted(false),
+		  mFinished(false)
+	{}
+
+
+	virtual ~MultisetPermutation()
+	{}
+
+
+	virtual size_t n() const
+	{
+		return mMultiplicities.size();
+	}
+
+
+	virtual size_t number() const
+	{
+		return number(mMultiplicities);
+	}
+
+
+	std::vector<size_t> const& multiplicities() const
+	{
+		return mMultiplicities;
+	}
+
+
+	virtual bool next()
+	{
+		bool ret(false);
+
+		if (mStarted)
+		{
+			// std::next_permutation() would start over after the last ordering
+			ret = !mFinished && std::next_permutation(mKUplet.begin(), mKUplet.end());
+		}
+		else
+		{
+			mStarted = true;
+
+			for (size_t element = 0; element < mMultiplicities.size(); ++element)
+			{
+				mKUplet.insert(mKUplet.end(), mMultiplicities[element], element);
+			}
+
+			ret = (mK > 0);
+		}
+
+		mFinished = !ret;
+
+		return ret;
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "MultisetPermutation::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "MultisetPermutation::nextBatch()");
+	}
+
+
+	// Multinomial coefficient, computed as a product of binomial coefficients so that it does not overflow before its result does
+	static size_t number(std::vector<size_t> const& multiplicities)
+	{
+		size_t ret(1);
+		size_t total(0);
+
+		for (const auto& multiplicity : multiplicities)
+		{
+			total += multiplicity;
+			ret = shlublu::Math::__multiplyChecked(ret, shlublu::Math::binomial(total, multiplicity), "MultisetPermutation::number()");
+		}
+
+		return ret;
+	}
+
+
+private:
+	const std::vector<size_t> mMultiplicities;
+
+	bool mStarted;
+	bool mFinished;
+};
+
+
+// Mixed-radix Cartesian product: element i of the k-uplets ranges over [0..radices[i]-1], the last one varying the fastest,
+// in constant amortized time. n() is the greatest radix.
+class CartesianProduct : public EnumerativeCombinatorics
+{
+public:
+	explicit CartesianProduct(std::vector<size_t> const& radices)
+		: EnumerativeCombinatorics(radices.size()),
+		  mRadices(radices),
+		  mN(radices.empty() ? 0 : *std::max_element(radices.begin(), radices.end())),
+		  mStarted(false)
+	{}
+
+
+	virtual ~CartesianProduct()
+	{}
+
+
+	virtual size_t n() const
+	{
+		return mN;
+	}
+
+
+	virtual size_t number() const
+	{
+		return number(mRadices);
+	}
+
+
+	std::vector<size_t> const& radices() const
+	{
+		return mRadices;
+	}
+
+
+	virtual bool next()
+	{
+		bool ret(false);
+
+		if (mStarted)
+		{
+			// Odometer: elements at their last value go back to zero and carry to the preceding one
+			size_t i(mKUplet.size());
+
+			while (i > 0 && mKUplet[i - 1] + 1 == mRadices[i - 1])
+			{
+				--i;
+			}
+
+			if (i > 0)
+			{
+				++mKUplet[i - 1];
+				std::fill(mKUplet.begin() + i, mKUplet.end(), size_t(0));
+				ret = true;
+			}
+		}
+		else
+		{
+			mStarted = true;
+
+			if (mK > 0 && std::find(mRadices.begin(), mRadices.end(), size_t(0)) == mRadices.end())
+			{
+				mKUplet.assign(mK, 0);
+				ret = true;
+			}
+		}
+
+		return ret;
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "CartesianProduct::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "CartesianProduct::nextBatch()");
+	}
+
+
+	static size_t number(std::vector<size_t> const& radices)
+	{
+		size_t ret(1);
+
+		for (const auto& radix : radices)
+		{
+			ret = shlublu::Math::__multiplyChecked(ret, radix, "CartesianProduct::number()");
+		}
+
+		return ret;
+	}
+
+
+private:
+	const std::vector<size_t> mRadices;
+	const size_t mN;
+
+	bool mStarted;
+};
+
+
+// Combinations in revolving door order (Knuth's algorithm R): each of them is obtained by replacing a single element of the previous one,
+// in constant amortized time. The k-uplet remains sorted.
+class MinimalChangeCombination : public EnumerativeCombinatorics
+{
+public:
+	static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+	MinimalChangeCombination(size_t n, size_t k)
+		: EnumerativeCombinatorics(k),
+		  mN(n),
+		  mEntered(none),
+		  mLeft(none),
+		  mStarted(false),
+		  mFinished(k == 0)
+	{
+		if (mK > mN)
+		{
+			throw std::invalid_argument("MinimalChangeCombination::MinimalChangeCombination(): k > n: " + shlublu::String::xtos(mK) + " > " + shlublu::String::xtos(mN));
+		}
+	}
+
+
+	virtual ~MinimalChangeCombination()
+	{}
+
+
+	virtual size_t n() const
+	{
+		return mN;
+	}
+
+
+	virtual size_t number() const
+	{
+		return Combination::number(mN, mK);
+	}
+
+
+	virtual bool next()
+	{
+		bool ret(false);
+
+		if (!mFinished)
+		{
+			if (mStarted)
+			{
+				ret = revolve();
+			}
+			else
+			{
+				mStarted = true;
+
+				mKUplet.resize(mK);
+				std::iota(mKUplet.begin(), mKUplet.end(), size_t(0));
+
+				ret = true;
+			}
+
+			mFinished = !ret;
+		}
+
+		return ret;
+	}
+
+
+	// Element added by the last call to next(), or none for the first combination
+	size_t entered() const
+	{
+		return mEntered;
+	}
+
+
+	// Element removed by the last call to next(), or none for the first combination
+	size_t left() const
+	{
+		return mLeft;
+	}
+
+
+	virtual size_t nextBatch(size_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "MinimalChangeCombination::nextBatch()");
+	}
+
+
+	virtual size_t nextBatch(uint8_t* buffer, size_t maxCount)
+	{
+		return fillBatch(*this, buffer, maxCount, "MinimalChangeCombination::nextBatch()");
+	}
+
+
+private:
+	// Knuth's c(j) is mKUplet[j - 1], and c(k + 1) is N
+	size_t upper(size_t j) const
+	{
+		return (j < mK) ? mKUplet[j] : mN;
+	}
+
+
+	void replace(size_t position, size_t element)
+	{
+		mLeft = mKUplet[position];
+		mEntered = element;
+		mKUplet[position] = element;
+	}
+
+
+	bool revolve()
+	{
+		// Easy case: the smallest element moves up (k odd) or down (k even) if it can
+		if (mK % 2 == 1 && mKUplet[0] + 1 < upper(1))
+		{
+			replace(0, mKUplet[0] + 1);
+			return true;
+		}
+
+		if (mK % 2 == 0 && mKUplet[0] > 0)
+		{
+			replace(0, mKUplet[0] - 1);
+			return true;
+		}
+
+		// Then c(j) is tried to be decreased and increased alternately, j going up
+		bool increase(mK % 2 == 0);
+
+		for (size_t j = 2; j <= mK; ++j, increase = !increase)
+		{
+			if (!increase && mKUplet[j - 1] >= j) // c(j - 1) is j - 2 and c(j) is c(j - 1) + 1 here
+			{
+				mLeft = mKUplet[j - 1];
+				mEntered = j - 2;
+
+				mKUplet[j - 1] = mKUplet[j - 2];
+				mKUplet[j - 2] = j - 2;
+
+				return true;
+			}
+
+			if (increase && mKUplet[j - 1] + 1 < upper(j)) // c(j - 1) is j - 2 here
+			{
+				mLeft = mKUplet[j - 2];
+				mEntered = mKUplet[j - 1] + 1;
+
+				mKUplet[j - 2] = mKUplet[j - 1];
+				++mKUplet[j - 1];
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+	const size_t mN;
+
+	size_t mEntered;
+	size_t mLeft;
+	bool mStarted;
+	bool mFinished;
+};
+
+
+// All the subsets of [0..N-1], from the empty one, in Gray code order (Knuth's loopless algorithm L): each of them is obtained by adding
+// or removing a single element of the previous one, in constant time. The elements of the k-uplet are not sorted.
+class Subset
+{
+public:
+	static constexpr size_t none = std::numeric_limits<size_t>::max();
+
+	explicit Subset(size_t n)
+		: mN(n),
+		  mFocus(n + 1),
+		  mPositions(n, none),
+		  mKUplet(),
+		  mEntered(none),
+		  mLeft(none),
+		  mStarted(false)
+	{
+		std::iota(mFocus.begin(), mFocus.end(), size_t(0));
+		mKUplet.reserve(n);
+	}
+
+
+	size_t n() const
+	{
+		return mN;
+	}
+
+
+	size_t number() const
+	{
+		return number(mN);
+	}
+
+
+	std::vector<size_t> const& kUplet() const
+	{
+		return mKUplet;
+	}
+
+
+	bool contains(size_t element) const
+	{
+		return element < mN && mPositions[element] != none;
+	}
+
+
+	bool next()
+	{
+		bool ret(!mStarted);
+
+		if (mStarted)
+		{
+			const size_t j(mFocus[0]);
+
+			if (j < mN)
+			{
+				mFocus[0] = 0;
+				mFocus[j] = mFocus[j + 1];
+				mFocus[j + 1] = j + 1;
+
+				toggle(j);
+				ret = true;
+			}
+		}
+
+		mStarted = true;
+
+		return ret;
+	}
+
+
+	// Element added by the last call to next(), or none if an element has been removed or for the empty set
+	size_t entered() const
+	{
+		return mEntered;
+	}
+
+
+	// Element removed by the last call to next(), or none if an element has been added or for the empty set
+	size_t left() const
+	{
+		return mLeft;
+	}
+
+
+	static size_t number(size_t n)
+	{
+		if (n >= size_t(std::numeric_limits<size_t>::digits))
+		{
+			throw std::overflow_error("Subset::number(): 2^" + shlublu::String::xtos(n) + " cannot be represented by this type.");
+		}
+
+		return size_t(1) << n;
+	}
+
+
+private:
+	void toggle(size_t element)
+	{
+		const size_t position(mPositions[element]);
+
+		if (position == none)
+		{
+			mPositions[element] = mKUplet.size();
+			mKUplet.push_back(element);
+
+			mEntered = element;
+			mLeft = none;
+		}
+		else
+		{
+			// The last element takes the place of the removed one
+			mKUplet[position] = mKUplet.back();
+			mPositions[mKUplet.back()] = position;
+			mKUplet.pop_back();
+			mPositions[element] = none;
+
+			mEntered = none;
+			mLeft = element;
+		}
+	}
+
+
+	const size_t mN;
+
+	std::vector<size_t> mFocus; // focus pointers of algorithm L
+	std::vector<size_t> mPositions; // position of each element in mKUplet, or none
+	std::vector<size_t> mKUplet;
+	size_t mEntered;
+	size_t mLeft;
+	bool mStarted;
+};
+
+// Depth-first walk of the tree of the prefixes of combinations, in lexicographic order. The leaves are the combinations, in the order of Combination.
+// This is meant for searches that can reject a prefix: skipSubtree() then skips all the combinations that start with it, without walking them.
+class DepthFirstCombination
+{
+public:
+	DepthFirstCombination(size_t n, size_t k)
+		: mN(n),
+		  mK(k),
+		  mPrefix(),
+		  mStarted(false),
+		  mSkipped(false)
+	{
+		if (mK > mN)
+		{
+			throw std::invalid_argument("DepthFirstCombination::DepthFirstCombination(): k > n: " + shlublu::String::xtos(mK) + " > " + shlublu::String::xtos(mN));
+		}
+
+		mPrefix.reserve(mK);
+	}
+
+
+	size_t n() const
+	{
+		return mN;
+	}
+
+
+	size_t k() const
+	{
+		return mK;
+	}
+
+
+	// Number of combinations, which are the leaves of the tree
+	size_t number() const
+	{
+		return Combination::number(mN, mK);
+	}
+
+
+	// Current prefix, which has between 1 and k elements
+	std::vector<size_t> const& kUplet() const
+	{
+		return mPrefix;
+	}
+
+
+	size_t depth() const
+	{
+		return mPrefix.size();
+	}
+
+
+	// Tells whether the current prefix is a combination
+	bool complete() const
+	{
+		return mStarted && mPrefix.size() == mK && mK > 0;
+	}
+
+
+	// Goes to the first child of the current prefix, or to the next sibling of the closest prefix that has one, in constant amortized time
+	bool next()
+	{
+		bool ret(false);
+
+		if (!mStarted)
+		{
+			mStarted = true;
+
+			if (mK > 0)
+			{
+				mPrefix.push_back(0);
+				ret = true;
+			}
+		}
+		else if (!mPrefix.empty())
+		{
+			if (!mSkipped && mPrefix.size() < mK)
+			{
+				mPrefix.push_back(mPrefix.back() + 1);
+			}
+			else
+			{
+				// Prefixes whose last element is at its maximum have no next sibling: element i can be N-K+i at most
+				while (!mPrefix.empty() && mPrefix.back() == mN - mK + mPrefix.size() - 1)
+				{
+					mPrefix.pop_back();
+				}
+
+				if (!mPrefix.empty())
+				{
+					++mPrefix.back();
+				}
+			}
+
+			mSkipped = false;
+			ret = !mPrefix.empty();
+		}
+
+		return ret;
+	}
+
+
+	// The next call to next() does not go below the current prefix
+	void skipSubtree()
+	{
+		mSkipped = true;
+	}
+
+
+private:
+	const size_t mN;
+	const size_t mK;
+
+	std::vector<size_t> mPrefix;
+	bool mStarted;
+	bool mSkipped;
+};
+
+// Base of the enumerators whose k is known at compile time. next() is provided by DERIVED without virtual dispatch, which lets
+// the compiler inline stepping into the loops of callers. k-uplets are stored in a std::array of ELEMENT.
+template<typename DERIVED, size_t K, typename ELEMENT> class FixedEnumerativeCombinatorics
+{
+	static_assert(std::is_integral<ELEMENT>::value && std::is_unsigned<ELEMENT>::value, "ELEMENT should be an unsigned integral type.");
+
+public:
+	using KUplet = std::array<ELEMENT, K>;
+
+	size_t n() const
+	{
+		return mN;
+	}
+
+	static constexpr size_t k()
+	{
+		return K;
+	}
+
+	size_t number() const
+	{
+		return DERIVED::number(mN, K);
+	}
+
+	KUplet const& kUplet() const
+	{
+		return mKUplet;
+	}
+
+
+	// Same as EnumerativeCombinatorics::nextBatch()
+	size_t nextBatch(ELEMENT* buffer, size_t maxCount)
+	{
+		DERIVED& derived(static_cast<DERIVED&>(*this));
+		size_t ret(0);
+
+		for (ELEMENT* row = buffer; ret < maxCount && derived.next(); ++ret, row += K)
+		{
+			std::copy(mKUplet.begin(), mKUplet.end(), row);
+		}
+
+		return ret;
+	}
+
+
+protected:
+	FixedEnumerativeCombinatorics(size_t n, const char* caller)
+		: mN(n),
+		  mKUplet()
+	{
+		if (K > mN)
+		{
+			throw std::invalid_argument(std::string(caller) + ": k > n: " + shlublu::String::xtos(K) + " > " + shlublu::String::xtos(mN));
+		}
+
+		if (mN > 0 && mN - 1 > size_t(std::numeric_limits<ELEMENT>::max()))
+		{
+			throw std::invalid_argument(std::string(caller) + ": elements up to " + shlublu::String::xtos(mN - 1) + " do not fit in ELEMENT");
+		}
+	}
+
+	const size_t mN;
+
+	KUplet mKUplet;
+};
+
+
+// Same enumeration as Combination(n, K)
+template<size_t K, typename ELEMENT = uint32_t> class FixedCombination : public FixedEnumerativeCombinatorics<FixedCombination<K, ELEMENT>, K, ELEMENT>
+{
+	using Base = FixedEnumerativeCombinatorics<FixedCombination<K, ELEMENT>, K, ELEMENT>;
+
+public:
+	explicit FixedCombination(size_t n)
+		: Base(n, "FixedCombination::FixedCombination()"),
+		  mStarted(false),
+		  mSought(false),
+		  mNextAvailable(K > 0)
+	{}
+
+
+	bool next()
+	{
+		const bool ret(mNextAvailable);
+
+		if (ret)
+		{
+			if (mSought)
+			{
+				mSought = false;
+			}
+			else if (mStarted)
+			{
+				size_t i(K - 1);
+
+				while (size_t(mKUplet[i]) == mN - K + i) // already at its maximum
+				{
+					--i;
+				}
+
+				++mKUplet[i];
+
+				for (++i; i < K; ++i)
+				{
+					mKUplet[i] = ELEMENT(mKUplet[i - 1] + 1);
+				}
+			}
+			else
+			{
+				mStarted = true;
+				std::iota(mKUplet.begin(), mKUplet.end(), ELEMENT(0));
+			}
+
+			mNextAvailable = (size_t(mKUplet[0]) != mN - K); // [N-K..N-1] is the last one
+		}
+
+		return ret;
+	}
+
+
+	// The next call to next() goes to the k-uplet at this position
+	void seek(size_t index)
+	{
+		const auto kUplet(Combination(mN, K).unrank(index));
+
+		std::transform(kUplet.begin(), kUplet.end(), mKUplet.begin(), [](size_t element) { return ELEMENT(element); });
+
+		mStarted = true;
+		mSought = true;
+		mNextAvailable = (K > 0);
+	}
+
+
+	using Base::number;
+
+	static size_t number(size_t n, size_t k)
+	{
+		return Combination::number(n, k);
+	}
+
+
+private:
+	using Base::mN;
+	using Base::mKUplet;
+
+	bool mStarted;
+	bool mSought;
+	bool mNextAvailable;
+};
+
+
+// Same enumeration as Arrangement(n, K)
+template<size_t K, typename ELEMENT = uint32_t> class FixedArrangement : public FixedEnumerativeCombinatorics<FixedArrangement<K, ELEMENT>, K, ELEMENT>
+{
+	using Base = FixedEnumerativeCombinatorics<FixedArrangement<K, ELEMENT>, K, ELEMENT>;
+
+public:
+	explicit FixedArrangement(size_t n)
+		: Base(n, "FixedArrangement::FixedArrangement()"),
+		  mCombinations(n),
+		  mStarted(false),
+		  mSought(false)
+	{}
+
+
+	bool next()
+	{
+		if (mSought) // the k-uplet set by seek() comes first
+		{
+			mSought = false;
+			return true;
+		}
+
+		bool ret(mStarted && std::next_permutation(mKUplet.begin(), mKUplet.end()));
+
+		if (!ret)
+		{
+			ret = mCombinations.next();
+
+			if (ret)
+			{
+				mKUplet = mCombinations.kUplet();
+			}
+
+			mStarted = ret; // once the combinations are exhausted, the last one is not permuted again
+		}
+
+		return ret;
+	}
+
+
+	// The next call to next() goes to the k-uplet at this position
+	void seek(size_t index)
+	{
+		const auto kUplet(Arrangement(mN, K).unrank(index));
+
+		std::transform(kUplet.begin(), kUplet.end(), mKUplet.begin(), [](size_t element) { return ELEMENT(element); });
+
+		mCombinations.seek(index / shlublu::Math::factorial(K));
+		mCombinations.next();
+
+		mStarted = true;
+		mSought = (K > 0);
+	}
+
+
+	using Base::number;
+
+	static size_t number(size_t n, size_t k)
+	{
+		return Arrangement::number(n, k);
+	}
+
+
+private:
+	using Base::mN;
+	using Base::mKUplet;
+
+	FixedCombination<K, ELEMENT> mCombinations;
+	bool mStarted;
+	bool mSought;
+};
+
+
+}
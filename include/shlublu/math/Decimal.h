@@ -0,0 +1,530 @@
+#pragma once
+
+/** @file
+	Fixed-point decimal numbers.
+
+	See Math::Decimal class documentation for details.
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <shlublu/math/Math.h>
+#include <shlublu/text/String.h>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/**
+	Rounding modes of decimal operations.
+*/
+enum class RoundingMode
+{
+	HalfAwayFromZero,	/**< Rounds to the nearest, halfway cases away from zero. This is what `roundX()` and `std::round()` do. */
+	HalfEven,			/**< Rounds to the nearest, halfway cases to the even neighbour (banker's rounding). */
+	TowardZero,			/**< Truncates. */
+	Down,				/**< Rounds toward negative infinity. */
+	Up					/**< Rounds toward positive infinity. */
+};
+
+
+/// @cond INTERNAL
+
+constexpr int64_t __decimalFactor(unsigned scale)
+{
+	int64_t ret(1);
+
+	for (unsigned i = 0; i < scale; ++i)
+	{
+		ret *= 10;
+	}
+
+	return ret;
+}
+
+
+// Quotient of a division whose remainder is not zero, adjusted according to the rounding mode.
+// `negative` is the sign of the exact quotient, `remainder` and `divisor` are absolute values.
+inline uint64_t __roundQuotient(uint64_t quotient, uint64_t remainder, uint64_t divisor, bool negative, RoundingMode mode, const char* caller)
+{
+	bool awayFromZero(false);
+
+	switch (mode)
+	{
+		case RoundingMode::HalfAwayFromZero:
+			awayFromZero = remainder >= divisor - remainder;
+			break;
+
+		case RoundingMode::HalfEven:
+			awayFromZero = (remainder > divisor - remainder) || (remainder == divisor - remainder && (quotient & 1) != 0);
+			break;
+
+		case RoundingMode::TowardZero:
+			break;
+
+		case RoundingMode::Down:
+			awayFromZero = negative;
+			break;
+
+		case RoundingMode::Up:
+			awayFromZero = !negative;
+			break;
+	}
+
+	// The magnitude would wrap around to zero, which would hide the overflow from __toSignedChecked()
+	if (awayFromZero && quotient == std::numeric_limits<uint64_t>::max())
+	{
+		throw std::overflow_error("Math::Decimal::" + std::string(caller) + "(): result cannot be represented.");
+	}
+
+	return awayFromZero ? quotient + 1 : quotient;
+}
+
+
+inline int64_t __toSignedChecked(uint64_t magnitude, bool negative, const char* caller)
+{
+	const uint64_t limit(negative ? uint64_t(std::numeric_limits<int64_t>::max()) + 1 : uint64_t(std::numeric_limits<int64_t>::max()));
+
+	if (magnitude > limit)
+	{
+		throw std::overflow_error("Math::Decimal::" + std::string(caller) + "(): result cannot be represented.");
+	}
+
+	return negative ? int64_t(0 - magnitude) : int64_t(magnitude);
+}
+
+
+// Multiplies by a power of ten, at compile time if possible
+constexpr int64_t __scaleUp(int64_t x, int64_t factor, const char* caller)
+{
+	if (x > std::numeric_limits<int64_t>::max() / factor || x < std::numeric_limits<int64_t>::min() / factor)
+	{
+		throw std::overflow_error("Math::Decimal::" + std::string(caller) + "(): " + String::xtos(x) + " cannot be represented.");
+	}
+
+	return x * factor;
+}
+
+
+inline uint64_t __magnitude(int64_t x)
+{
+	return (x < 0) ? 0 - uint64_t(x) : uint64_t(x);
+}
+
+
+// Computes round(a * b / d) without intermediate overflow, the product being held on 128 bits
+inline int64_t __mulDivRounded(int64_t a, int64_t b, int64_t d, RoundingMode mode, const char* caller)
+{
+	if (d == 0)
+	{
+		throw std::domain_error("Math::Decimal::" + std::string(caller) + "(): division by zero.");
+	}
+
+	const bool negative(a != 0 && b != 0 && (((a < 0) != (b < 0)) != (d < 0)));
+	const uint64_t x(__magnitude(a));
+	const uint64_t y(__magnitude(b));
+	const uint64_t divisor(__magnitude(d));
+
+	// 64 x 64 -> 128 bits product from 32-bit halves
+	const uint64_t xLow(x & 0xFFFFFFFF), xHigh(x >> 32);
+	const uint64_t yLow(y & 0xFFFFFFFF), yHigh(y >> 32);
+	const uint64_t lowLow(xLow * yLow);
+	const uint64_t middle1(xHigh * yLow + (lowLow >> 32));
+	const uint64_t middle2(xLow * yHigh + (middle1 & 0xFFFFFFFF));
+
+	uint64_t high(xHigh * yHigh + (middle1 >> 32) + (middle2 >> 32));
+	uint64_t low((middle2 << 32) | (lowLow & 0xFFFFFFFF));
+	uint64_t quotient(0);
+	uint64_t remainder(0);
+
+	if (high == 0)
+	{
+		quotient = low / divisor;
+		remainder = low % divisor;
+	}
+	else if (high >= divisor)
+	{
+		throw std::overflow_error("Math::Decimal::" + std::string(caller) + "(): result cannot be represented.");
+	}
+	else
+	{
+		// Restoring division, the quotient being known to fit 64 bits
+		remainder = high;
+
+		for (int bit = 63; bit >= 0; --bit)
+		{
+			const bool carry((remainder >> 63) != 0);
+
+			remainder = (remainder << 1) | ((low >> bit) & 1);
+
+			if (carry || remainder >= divisor)
+			{
+				remainder -= divisor;
+				quotient |= uint64_t(1) << bit;
+			}
+		}
+	}
+
+	if (remainder != 0)
+	{
+		quotient = __roundQuotient(quotient, remainder, divisor, negative, mode, caller);
+	}
+
+	return __toSignedChecked(quotient, negative, caller);
+}
+
+/// @endcond
+
+
+/**
+	Signed decimal number with a fixed number of fractional digits.
+	The value is stored as a 64-bit integer count of \f$10^{-Scale}\f$ units: `Decimal<2>` counts cents. Additions and subtractions are
+	therefore exact, and multiplications and divisions are rounded once, to the nearest unit by default, which avoids the off-by-a-cent errors
+	that binary floating point and repeated rounding give.
+
+	All operations check for overflow and throw `std::overflow_error` instead of wrapping around. Intermediate products are computed on 128 bits.
+
+	Overloads of `roundX()`, `round2()`, `proportionalIncrease()` and `increaseRate()` are provided.
+
+	<b>Example</b>
+	@code
+	const Math::Decimal<2> price(Math::Decimal<2>::fromUnits(1999)); // 19.99
+	const Math::Decimal<4> vatRate(0.2);
+
+	const Math::Decimal<2> vat(price * vatRate);  // 4.00 (3.998 rounded half away from zero)
+	std::cout << price + vat << std::endl;        // 23.99
+	@endcode
+
+	@tparam Scale the number of fractional digits. It should not be greater than 18.
+*/
+template<unsigned Scale> class Decimal
+{
+	static_assert(Scale <= 18, "Scale should not be greater than 18.");
+
+public:
+	static constexpr unsigned scale = Scale; /**< Number of fractional digits. */
+	static constexpr int64_t unitsPerOne = __decimalFactor(Scale); /**< Number of units in 1, that is \f$10^{Scale}\f$. */
+
+public:
+	/**
+		Constructor.
+		The value is zero.
+	*/
+	constexpr Decimal()
+		: mUnits(0)
+	{}
+
+	/**
+		Constructor from an integer.
+		@tparam I the type of `value`. This type should be integral.
+		@param value the value
+		@exception std::overflow_error if `value` cannot be represented
+	*/
+	template<typename I, typename = typename std::enable_if<std::is_integral<I>::value>::type>
+	constexpr explicit Decimal(I value)
+		: mUnits(__scaleUp(int64_t(value), unitsPerOne, "Decimal"))
+	{}
+
+	/**
+		Constructor from a floating point value.
+		@param value the value. It is rounded to `Scale` fractional digits as `roundX(value, Scale)` would do with the default mode.
+		@param mode the rounding mode
+		@exception std::invalid_argument if `value` is not finite
+		@exception std::overflow_error if `value` cannot be represented
+	*/
+	explicit Decimal(double value, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+		: mUnits(0)
+	{
+		if (!std::isfinite(value))
+		{
+			throw std::invalid_argument("Math::Decimal::Decimal(): " + String::xtos(value) + " is not finite.");
+		}
+
+		const double scaled(value * double(unitsPerOne));
+		double rounded(0.0);
+
+		switch (mode)
+		{
+			case RoundingMode::HalfAwayFromZero: rounded = std::round(scaled); break;
+			case RoundingMode::HalfEven: rounded = scaled - std::remainder(scaled, 1.0); break;
+			case RoundingMode::TowardZero: rounded = std::trunc(scaled); break;
+			case RoundingMode::Down: rounded = std::floor(scaled); break;
+			case RoundingMode::Up: rounded = std::ceil(scaled); break;
+		}
+
+		if (!(rounded >= -9223372036854775808.0 && rounded < 9223372036854775808.0))
+		{
+			throw std::overflow_error("Math::Decimal::Decimal(): " + String::xtos(value) + " cannot be represented.");
+		}
+
+		mUnits = int64_t(rounded);
+	}
+
+	/**
+		Constructor from a decimal number of another scale.
+		@tparam OtherScale the scale of `other`
+		@param other the value
+		@param mode the rounding mode, used if `OtherScale > Scale`
+		@exception std::overflow_error if `other` cannot be represented
+	*/
+	template<unsigned OtherScale>
+	explicit Decimal(Decimal<OtherScale> other, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+		: mUnits(0)
+	{
+		if (OtherScale > Scale)
+		{
+			mUnits = __mulDivRounded(other.units(), 1, __decimalFactor(OtherScale - Scale), mode, "Decimal");
+		}
+		else
+		{
+			mUnits = __scaleUp(other.units(), __decimalFactor(Scale - OtherScale), "Decimal");
+		}
+	}
+
+	/**
+		Builds a decimal number from its count of units.
+		@param units the number of \f$10^{-Scale}\f$ units
+		@return the decimal number `units` \f$\times 10^{-Scale}\f$
+	*/
+	static constexpr Decimal fromUnits(int64_t units)
+	{
+		Decimal ret;
+		ret.mUnits = units;
+
+		return ret;
+	}
+
+	/**
+		Returns the count of units.
+		@return the value multiplied by \f$10^{Scale}\f$
+	*/
+	constexpr int64_t units() const
+	{
+		return mUnits;
+	}
+
+	/**
+		Converts this value to `double`.
+		@return the nearest `double` to this value
+	*/
+	double toDouble() const
+	{
+		return double(mUnits) / double(unitsPerOne);
+	}
+
+	/**
+		Returns the decimal representation of this value.
+		@return the representation of this value with exactly `Scale` fractional digits, such as `"-0.50"` for `Decimal<2>`
+	*/
+	std::string toString() const
+	{
+		const uint64_t magnitude(__magnitude(mUnits));
+		std::string ret(std::to_string(magnitude / uint64_t(unitsPerOne)));
+
+		if (Scale > 0)
+		{
+			const std::string fraction(std::to_string(magnitude % uint64_t(unitsPerOne)));
+			ret += "." + std::string(Scale - fraction.size(), '0') + fraction;
+		}
+
+		return (mUnits < 0) ? "-" + ret : ret;
+	}
+
+	/**
+		Multiplies this value by another one, rounding the result to `Scale` fractional digits.
+		@tparam OtherScale the scale of `other`
+		@param other the value to multiply by
+		@param mode the rounding mode
+		@return the rounded product
+		@exception std::overflow_error if the result cannot be represented
+	*/
+	template<unsigned OtherScale> Decimal multiply(Decimal<OtherScale> other, RoundingMode mode = RoundingMode::HalfAwayFromZero) const
+	{
+		return fromUnits(__mulDivRounded(mUnits, other.units(), Decimal<OtherScale>::unitsPerOne, mode, "multiply"));
+	}
+
+	/**
+		Divides this value by another one, rounding the result to `Scale` fractional digits.
+		@tparam OtherScale the scale of `other`
+		@param other the value to divide by
+		@param mode the rounding mode
+		@return the rounded quotient
+		@exception std::domain_error if `other` is zero
+		@exception std::overflow_error if the result cannot be represented
+	*/
+	template<unsigned OtherScale> Decimal divide(Decimal<OtherScale> other, RoundingMode mode = RoundingMode::HalfAwayFromZero) const
+	{
+		return fromUnits(__mulDivRounded(mUnits, Decimal<OtherScale>::unitsPerOne, other.units(), mode, "divide"));
+	}
+
+	/// @cond INTERNAL
+
+	Decimal& operator+=(Decimal other)
+	{
+		if ((other.mUnits > 0 && mUnits > std::numeric_limits<int64_t>::max() - other.mUnits) ||
+			(other.mUnits < 0 && mUnits < std::numeric_limits<int64_t>::min() - other.mUnits))
+		{
+			throw std::overflow_error("Math::Decimal::operator+=(): result cannot be represented.");
+		}
+
+		mUnits += other.mUnits;
+		return *this;
+	}
+
+	Decimal& operator-=(Decimal other)
+	{
+		if ((other.mUnits < 0 && mUnits > std::numeric_limits<int64_t>::max() + other.mUnits) ||
+			(other.mUnits > 0 && mUnits < std::numeric_limits<int64_t>::min() + other.mUnits))
+		{
+			throw std::overflow_error("Math::Decimal::operator-=(): result cannot be represented.");
+		}
+
+		mUnits -= other.mUnits;
+		return *this;
+	}
+
+	template<unsigned OtherScale> Decimal& operator*=(Decimal<OtherScale> other) { return *this = multiply(other); }
+	template<unsigned OtherScale> Decimal& operator/=(Decimal<OtherScale> other) { return *this = divide(other); }
+
+	Decimal& operator*=(int64_t factor)
+	{
+		mUnits = __mulDivRounded(mUnits, factor, 1, RoundingMode::TowardZero, "operator*=");
+		return *this;
+	}
+
+	Decimal& operator/=(int64_t divisor)
+	{
+		mUnits = __mulDivRounded(mUnits, 1, divisor, RoundingMode::HalfAwayFromZero, "operator/=");
+		return *this;
+	}
+
+	Decimal operator-() const
+	{
+		return Decimal() - *this;
+	}
+
+	/// @endcond
+
+private:
+	/// @cond INTERNAL
+
+	int64_t mUnits;
+
+	/// @endcond
+};
+
+
+/// @cond INTERNAL
+
+template<unsigned S> Decimal<S> operator+(Decimal<S> lhs, Decimal<S> rhs) { return lhs += rhs; }
+template<unsigned S> Decimal<S> operator-(Decimal<S> lhs, Decimal<S> rhs) { return lhs -= rhs; }
+template<unsigned S, unsigned T> Decimal<S> operator*(Decimal<S> lhs, Decimal<T> rhs) { return lhs.multiply(rhs); }
+template<unsigned S, unsigned T> Decimal<S> operator/(Decimal<S> lhs, Decimal<T> rhs) { return lhs.divide(rhs); }
+template<unsigned S> Decimal<S> operator*(Decimal<S> lhs, int64_t rhs) { return lhs *= rhs; }
+template<unsigned S> Decimal<S> operator*(int64_t lhs, Decimal<S> rhs) { return rhs *= lhs; }
+template<unsigned S> Decimal<S> operator/(Decimal<S> lhs, int64_t rhs) { return lhs /= rhs; }
+
+template<unsigned S> constexpr bool operator==(Decimal<S> lhs, Decimal<S> rhs) { return lhs.units() == rhs.units(); }
+template<unsigned S> constexpr bool operator!=(Decimal<S> lhs, Decimal<S> rhs) { return lhs.units() != rhs.units(); }
+template<unsigned S> constexpr bool operator<(Decimal<S> lhs, Decimal<S> rhs) { return lhs.units() < rhs.units(); }
+template<unsigned S> constexpr bool operator<=(Decimal<S> lhs, Decimal<S> rhs) { return lhs.units() <= rhs.units(); }
+template<unsigned S> constexpr bool operator>(Decimal<S> lhs, Decimal<S> rhs) { return lhs.units() > rhs.units(); }
+template<unsigned S> constexpr bool operator>=(Decimal<S> lhs, Decimal<S> rhs) { return lhs.units() >= rhs.units(); }
+
+template<unsigned S> std::ostream& operator<<(std::ostream& os, Decimal<S> value) { return os << value.toString(); }
+
+/// @endcond
+
+
+/**
+	Rounds a decimal number to the specified number of fractional digits.
+	@tparam S the scale of `number`
+	@param number the number to round
+	@param digits the number of fractional digits to round `number` to. Nothing is done if it is `S` or more.
+	@param mode the rounding mode. The default one matches `roundX(T, size_t)`.
+	@return the rounded value of `number`
+	@see roundX(T, size_t)
+*/
+template<unsigned S> Decimal<S> roundX(Decimal<S> number, size_t digits, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+{
+	Decimal<S> ret(number);
+
+	if (digits < S)
+	{
+		const int64_t step(__decimalFactor(unsigned(S - digits)));
+		ret = Decimal<S>::fromUnits(__scaleUp(__mulDivRounded(number.units(), 1, step, mode, "roundX"), step, "roundX"));
+	}
+
+	return ret;
+}
+
+
+/**
+	Rounds a decimal number to 2 fractional digits.
+	@tparam S the scale of `number`
+	@param number the number to round
+	@param mode the rounding mode
+	@return the rounded value of `number`
+	@see roundX(Decimal<S>, size_t, RoundingMode)
+*/
+template<unsigned S> Decimal<S> round2(Decimal<S> number, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+{
+	return roundX(number, 2, mode);
+}
+
+
+/**
+	Returns the proportional increase from an initial value to a final value, computed exactly then rounded once.
+	@tparam S the scale of the values
+	@tparam RS the scale of the result. Rates usually need more fractional digits than amounts, for example `proportionalIncrease<2, 6>(a, b)`.
+	@param initialValue the initial value
+	@param finalValue the final value
+	@param mode the rounding mode
+	@return \f$(Vfinal - Vinitial) / Vinitial\f$ rounded to `RS` fractional digits
+	@exception std::invalid_argument if `initialValue` is zero
+	@exception std::overflow_error if the result cannot be represented
+	@see proportionalIncrease(VALUES_TYPE, VALUES_TYPE)
+*/
+template<unsigned S, unsigned RS = S>
+Decimal<RS> proportionalIncrease(Decimal<S> initialValue, Decimal<S> finalValue, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+{
+	if (initialValue.units() == 0)
+	{
+		throw std::invalid_argument("Math::proportionalIncrease(): initialValue (" + initialValue.toString() + ") should not be zero.");
+	}
+
+	const Decimal<S> difference(finalValue - initialValue);
+
+	return Decimal<RS>::fromUnits(__mulDivRounded(difference.units(), Decimal<RS>::unitsPerOne, initialValue.units(), mode, "proportionalIncrease"));
+}
+
+
+/**
+	Converts an proportional increase over a number of periods to an increase rate per period.
+	The root cannot be computed exactly: it is computed in `double` then rounded to `S` fractional digits.
+	@tparam S the scale of the increase and of the result
+	@param overallIncrease the proportional increase over all the periods of times
+	@param numPeriods the number of periods of time that are covered
+	@param mode the rounding mode
+	@return the increase rate \f$\sqrt[N]{O + 1} - 1\f$ rounded to `S` fractional digits
+	@exception std::invalid_argument if `numPeriods` is zero
+	@exception std::domain_error if `overallIncrease <= -1`
+	@see increaseRate(T, size_t)
+*/
+template<unsigned S> Decimal<S> increaseRate(Decimal<S> overallIncrease, size_t numPeriods, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+{
+	return Decimal<S>(increaseRate(overallIncrease.toDouble(), numPeriods), mode);
+}
+
+}
+
+}
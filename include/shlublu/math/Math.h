@@ -1,420 +1,1528 @@
-#pragma once
-
-#include <algorithm>
-#include <cmath> 
-#include <functional>
-
-#include <shlublu/text/String.h>
-
-/** @file
-	Helper functions not included in the standard <a href="https://www.cplusplus.com/reference/cmath/">&lt;cmath&gt;</a> header.
-
-	See Math namespace documentation for details.
-*/
-
-
-namespace shlublu
-{
-
-/**
-	@namespace shlublu::Math
-	Set of helper constants and functions.
-*/
-namespace Math
-{
-	/**
-		Constant \f$e\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$e\f$
-	*/
-	template<typename T> inline T constantE() 
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(2.71828182845904523536); 
-	} 
-
-	/**
-		Constant \f$log2(e)\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$log2(e)\f$
-	*/
-	template<typename T> inline T constantLog2e()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(1.44269504088896340736); 
-	} 
-
-	/**
-		Constant \f$log10(e)\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$log10(e)\f$
-	*/
-	template<typename T> inline T constantLog10e()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(0.434294481903251827651); 
-	} 
-
-	/**
-		Constant \f$ln(2)\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$ln(2)\f$
-	*/
-	template<typename T> inline T constantLn2()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(0.693147180559945309417); 
-	} 
-
-	/**
-		Constant \f$ln(10)\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$ln(10)\f$
-	*/
-	template<typename T> inline T constantLn10()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(2.30258509299404568402); 
-	} 
-
-	/**
-		Constant \f$\pi\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$\pi\f$
-	*/
-	template<typename T> inline T constantPi()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(3.14159265358979323846); 
-	} 
-
-	/**
-		Constant \f$\pi / 2\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$\pi / 2\f$
-	*/
-	template<typename T> inline T constantPiBy2()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(1.57079632679489661923); 
-	} 
-
-	/**
-		Constant \f$\pi / 4\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$\pi / 4\f$
-	*/
-	template<typename T> inline T constantPiBy4()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(0.785398163397448309616); 
-	} 
-
-	/**
-		Constant \f$1 / \pi\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$1 / \pi\f$
-	*/
-	template<typename T> inline T constant1ByPi()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(0.318309886183790671538); 
-	} 
-
-	/**
-		Constant \f$2 / \pi\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$2 / \pi\f$
-	*/
-	template<typename T> inline T constant2ByPi()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
-		return T(0.636619772367581343076);
-	} 
-
-	/**
-		Constant \f$2 / \sqrt{\pi}\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$2 / \sqrt{\pi}\f$
-	*/
-	template<typename T> inline T constant2BySqrtPi() 
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(1.12837916709551257390); 
-	} 
-
-	/**
-		Constant \f$\sqrt{2}\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$\sqrt{2}\f$
-	*/
-	template<typename T> inline T constantSqrt2()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point."); 
-		return T(1.41421356237309504880);
-	}
-
-	/**
-		Constant \f$1 / \sqrt{2}\f$.
-		As per the legacy `<math.h>` C header.
-		@tparam T the type of the returned value. This type should be floating point.
-		@return \f$1 / \sqrt{2}\f$
-	*/
-	template<typename T> inline T constant1BySqrt2()
-	{ 
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
-		return T(0.707106781186547524401); 
-	} 
-
-
-	/**
-		Maximal value that can be incremented to give a different value.
-		Determined as \f$f + 1 \neq f\f$.
-		@tparam T the type to apply this function to. This type should be floating point.
-		@return the value applicable to `T`
-
-		@note Linux `long double` is currently handled as `double` though it would support higher values.
-	*/
-	template<typename T> inline T constantMaxIncrementable()
-	{
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
-		return 9007199254740991.0; 
-	}
-	
-
-	/// @cond INTERNAL
-	template<> inline float constantMaxIncrementable()
-	{
-		return 16777215.0f;
-	}
-	/// @endcond 
-
-
-	/**
-		Minimal value that can be decremented to give a different value.
-		Determined as \f$f - 1 \neq f\f$.
-		@tparam T the type to apply this function to. This type should be floating point.
-		@return the value applicable to `T`
-
-		@note Linux `long double` is currently handled as `double` though it would support lower values.
-	*/
-	template<typename T> inline T constantMinDecrementable()
-	{
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
-		return -constantMaxIncrementable<T>();
-	}
-
-	   
-	/**
-		Tells whether `x` and `y` are of the same sign.
-		
-		@tparam the type of `x` and `y`. This type should be arithmetic.
-		@param x a value
-		@param y another value
-		@return `true` if `x` and `y` are of the same sign, `false` otherwise
-	*/
-	template<typename T> bool sameSign(T x, T y)
-	{
-		static_assert(std::is_arithmetic<T>::value, "Type should be arithmetic.");
-
-		return (x >= T(0)) ^ (y < T(0));
-	}
-
-
-	/**
-		Clamps a value to a range.
-		@tparam T The type of the value and the range. This type should be non-boolean arithmetic.
-		@param value the value to clamp
-		@param minVal the lower inclusive bound of the range
-		@param maxVal the upper inclusive bound of the range
-		@return `value` if \f$value \in [minVal, maxVal]\f$, `minVal` if \f$value < minVal\f$, and `maxVal` if \f$value > maxVal\f$
-		@exception std::invalid_argument if `minVal > maxVal`
-	*/
-	template<typename T> T clamp(T value, T minVal, T maxVal)
-	{
-		static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Type should be non-boolean arithmetic.");
-
-		if (minVal > maxVal)
-		{
-			throw std::invalid_argument("Math::clamp(): " + String::xtos(minVal) + " > " + String::xtos(maxVal));
-		}
-
-		return std::max<T>(minVal, std::min<T>(value, maxVal));
-	}
-
-
-	/**
-		Rounds a number to the specified number of fractional digits.
-		@tparam T the type of the number to round and of the returned value. This type should be floating point.
-		@param number the number to round
-		@param digits the number of fractional digits to round `number` to
-		@return the rounded value of `number`
-	*/
-	template<typename T> T roundX(T number, size_t digits)
-	{
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
-		
-		const T factor(std::pow(T(10.0), T(digits)));
-
-		return std::round(factor * number) / factor;
-	}
-
-
-	/**
-		Rounds a number to 2 fractional digits.
-		@tparam T the type of the number to round and of the returned value. This type should be floating point.
-		@param number the number to round
-		@return the rounded value of `number`
-		@see roundX()
-	*/
-	template<typename T> T round2(T number)
-	{
-		return roundX(number, 2);
-	}
-
-
-	/**
-		Returns the factorial of a given number.
-		This function is only defined for \f$n \in \mathbb{N+}\f$
-
-		@tparam T the type of `n` and of the returned value
-		@param n the number whose factorial is to be calculated
-		@return the factorial of `n`
-		@exception std::domain_error if \f$n \notin \mathbb{N+}\f$
-	*/
-	template<typename T> T factorial(T n)
-	{
-		static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Type should be arithmetic.");
-
-		if (n < T(0))
-		{
-			throw std::domain_error("Math::factorial(): " + String::xtos(n) + " is negative.");
-		}
-
-		#ifndef _WIN32
-		_Pragma("GCC diagnostic push")
-		_Pragma("GCC diagnostic ignored \"-Wconversion\"")
-		#endif		
-
-		if (std::is_floating_point<T>::value && std::round(n) != n)
-		{
-			throw std::domain_error("Math::factorial(): " + String::xtos(n) + " is not round.");
-		}
-
-		#ifndef _WIN32
-		_Pragma("GCC diagnostic pop")
-		#endif		
-
-		const std::function<T(T)> factorialUnchecked =
-		(
-				[&factorialUnchecked](T n) -> T
-				{
-					return (n > T(1)) ? (factorialUnchecked(n - T(1)) * n) : T(1);
-				}
-		);
-
-		return factorialUnchecked(n);
-	}
-
-
-	/**
-		Returns the proportional increase from an initial value to a final value.
-		The increase `I` is defined as \f$Vfinal = Vinitial + (Vinitial \times I)\f$, leading to \f$I = (Vfinal / Vinitial) - 1\f$. 
-		
-		If `I` be negative, this is a decrease. 
-
-		@tparam VALUES_TYPE the type of the initial and final values. This type should be arithmetic.
-		@tparam INCREASE_TYPE the type of the resulting increase. This type should be floating point.
-		@param initialValue the initial value
-		@param finalValue the final value
-		@return The proportional increase \f$(Vfinal / Vinitial) - 1\f$. `initialValue` is converted to `INCREASE_TYPE` to ensure this is a floating point division.
-		@exception std::invalid_argument if `initialValue` is zero
-	*/
-	template<typename VALUES_TYPE, typename INCREASE_TYPE = VALUES_TYPE> 
-	inline INCREASE_TYPE proportionalIncrease(VALUES_TYPE initialValue, VALUES_TYPE finalValue)
-	{
-		static_assert(std::is_arithmetic<VALUES_TYPE>::value, "VALUES_TYPE should be arithmetic.");
-		static_assert(std::is_floating_point<INCREASE_TYPE>::value, "INCREASE_TYPE should be floating point.");
-
-		if (initialValue == 0)
-		{
-			throw std::invalid_argument("Math::proportionalIncrease(): initialValue (" + String::xtos(initialValue) + ") should not be zero.");
-		}
-
-		return (finalValue / INCREASE_TYPE(initialValue)) - INCREASE_TYPE(1.0);
-	}
-
-
-	/**
-		Converts an proportional increase over a number of periods to an increase rate per period.
-		This is the increase rate that produces the overall increase when applied to each period.<br />
-		This rate `R` is defined as \f$(R + 1) ^ N = O + 1\f$, where `N` is the number of periods and `O` the overall increase. This leads to \f$R = \sqrt[N]{O + 1} - 1\f$. 
-
-		This function only applies to \f$O > -1\f$ as `-1` or less would correspond to a decrease of 100% or more, leading the result `R` not to be a real number. 
-
-		@tparam T the type of the overall increase and the returned rate. This type should be floating point.
-		@param overallIncrease the proportional increase over all the periods of times
-		@param numPeriods the number of periods of time that are covered
-		@return the increase rate \f$\sqrt[N]{O + 1} - 1\f$
-		@exception std::invalid_argument if `numPeriods` is zero 
-		@exception std::domain_error if `overallIncrease <= -1`
-	*/
-	template<typename T> inline T increaseRate(T overallIncrease, size_t numPeriods)
-	{
-		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
-
-		if (numPeriods == 0)
-		{
-			throw std::invalid_argument("Math::increaseRate(): numPeriods (" + String::xtos(numPeriods) + ") should be strictly positive.");
-		}
-
-		if (overallIncrease <= T(-1.0))
-		{
-			throw std::domain_error("Math::increaseRate(): overallIncrease (" + String::xtos(overallIncrease) + ") should be greater than -1.0 for the result to be real.");
-		}
-
-		return std::pow<T>(T(1.0) + overallIncrease, T(1.0) / T(numPeriods)) - T(1.0);
-	}
-
-
-	/**
-		Returns the increase rate per period giving a final value from an initial value over a given number of periods.
-
-		This rate `R` is defined as \f$Vfinal = Vinitial \times (R + 1)^N\f$ where `N` is the number of periods.
-		This leads to \f$R = \sqrt[N]{Vfinal / Vinitial} - 1\f$.
-		
-		This function only applies to:
-		<ul>
-		<li>\f$Vinitial > 0\f$ and</li>
-		<li>\f$Vfinal / Vinitial > 0\f$ as zero or less would correspond to a decrease of 100% or more, leading the result `R` not to be a real number.</li>
-		</ul>
-
-		@tparam VALUES_TYPE the type of the initial and final values. This type should be arithmetic.
-		@tparam INCREASE_TYPE the type of the resulting increase. This type should be floating point.
-		@param initialValue the initial value
-		@param finalValue the final value
-		@param numPeriods the number of periods of time that are covered
-		@return the increase rate \f$\sqrt[N]{Vfinal / Vinitial} - 1\f$
-		@exception std::invalid_argument if `initialValue` is zero or if `numPeriods` is zero 
-		@exception std::domain_error if `initialValue` is zero, or if `finalValue / initialValue <= 0`
-	*/
-	template<typename VALUES_TYPE, typename INCREASE_TYPE = VALUES_TYPE>
-	inline INCREASE_TYPE increaseRate(VALUES_TYPE initialValue, VALUES_TYPE finalValue, size_t numPeriods)
-	{
-		return increaseRate(proportionalIncrease<VALUES_TYPE, INCREASE_TYPE>(initialValue, finalValue), numPeriods);
-	}	
-}
-
-}
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath> 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <shlublu/text/String.h>
+
+#if defined(__SIZEOF_FLOAT128__) && defined(__GNUC__) && !defined(__clang__) && !defined(__STRICT_ANSI__)
+#define __SHLUBLU_FLOAT128
+#endif
+
+/** @file
+	Helper functions not included in the standard <a href="https://www.cplusplus.com/reference/cmath/">&lt;cmath&gt;</a> header.
+
+	See Math namespace documentation for details.
+*/
+
+
+namespace shlublu
+{
+
+/**
+	@namespace shlublu::Math
+	Set of helper constants and functions.
+*/
+namespace Math
+{
+	/// @cond INTERNAL
+
+	template<typename T> constexpr T __floatingPointConstant(double value)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+		return T(value);
+	}
+
+	/// @endcond
+
+
+	/**
+		Constant \f$e\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantE()
+	*/
+	template<typename T> inline constexpr T e = __floatingPointConstant<T>(2.71828182845904523536);
+
+	/**
+		Constant \f$log2(e)\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantLog2e()
+	*/
+	template<typename T> inline constexpr T log2e = __floatingPointConstant<T>(1.44269504088896340736);
+
+	/**
+		Constant \f$log10(e)\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantLog10e()
+	*/
+	template<typename T> inline constexpr T log10e = __floatingPointConstant<T>(0.434294481903251827651);
+
+	/**
+		Constant \f$ln(2)\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantLn2()
+	*/
+	template<typename T> inline constexpr T ln2 = __floatingPointConstant<T>(0.693147180559945309417);
+
+	/**
+		Constant \f$ln(10)\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantLn10()
+	*/
+	template<typename T> inline constexpr T ln10 = __floatingPointConstant<T>(2.30258509299404568402);
+
+	/**
+		Constant \f$\pi\f$, usable in constant expressions.
+		Unlike the functions such as `constantPi()`, the variable templates of this namespace can be used in `static_assert`, array bounds, or
+		broadcasts to SIMD registers that the compiler folds into a single load. `long double` and, with GCC extensions, `__float128` have
+		their own specializations that are accurate to their precision.
+		@tparam T the type of the constant. This type should be floating point.
+
+		<b>Typical example of use</b>
+		@code
+		static_assert(Math::pi<float> > 3.14f, "Should be usable in constant expressions.");
+
+		const __m256d twoPi(_mm256_set1_pd(2.0 * Math::pi<double>));
+		const long double extendedPi(Math::pi<long double>);
+		@endcode
+		@see constantPi()
+	*/
+	template<typename T> inline constexpr T pi = __floatingPointConstant<T>(3.14159265358979323846);
+
+	/**
+		Constant \f$\pi / 2\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantPiBy2()
+	*/
+	template<typename T> inline constexpr T piBy2 = __floatingPointConstant<T>(1.57079632679489661923);
+
+	/**
+		Constant \f$\pi / 4\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantPiBy4()
+	*/
+	template<typename T> inline constexpr T piBy4 = __floatingPointConstant<T>(0.785398163397448309616);
+
+	/**
+		Constant \f$1 / \pi\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constant1ByPi()
+	*/
+	template<typename T> inline constexpr T oneByPi = __floatingPointConstant<T>(0.318309886183790671538);
+
+	/**
+		Constant \f$2 / \pi\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constant2ByPi()
+	*/
+	template<typename T> inline constexpr T twoByPi = __floatingPointConstant<T>(0.636619772367581343076);
+
+	/**
+		Constant \f$2 / \sqrt{\pi}\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constant2BySqrtPi()
+	*/
+	template<typename T> inline constexpr T twoBySqrtPi = __floatingPointConstant<T>(1.12837916709551257390);
+
+	/**
+		Constant \f$\sqrt{2}\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constantSqrt2()
+	*/
+	template<typename T> inline constexpr T sqrt2 = __floatingPointConstant<T>(1.41421356237309504880);
+
+	/**
+		Constant \f$1 / \sqrt{2}\f$, usable in constant expressions.
+		@tparam T the type of the constant. This type should be floating point.
+		@see constant1BySqrt2()
+	*/
+	template<typename T> inline constexpr T oneBySqrt2 = __floatingPointConstant<T>(0.707106781186547524401);
+
+
+	/// @cond INTERNAL
+
+	template<> inline constexpr long double e<long double> = 2.71828182845904523536028747135266250L;
+	template<> inline constexpr long double log2e<long double> = 1.44269504088896340735992468100189214L;
+	template<> inline constexpr long double log10e<long double> = 0.434294481903251827651128918916605082L;
+	template<> inline constexpr long double ln2<long double> = 0.693147180559945309417232121458176568L;
+	template<> inline constexpr long double ln10<long double> = 2.30258509299404568401799145468436421L;
+	template<> inline constexpr long double pi<long double> = 3.14159265358979323846264338327950288L;
+	template<> inline constexpr long double piBy2<long double> = 1.57079632679489661923132169163975144L;
+	template<> inline constexpr long double piBy4<long double> = 0.785398163397448309615660845819875721L;
+	template<> inline constexpr long double oneByPi<long double> = 0.318309886183790671537767526745028724L;
+	template<> inline constexpr long double twoByPi<long double> = 0.636619772367581343075535053490057448L;
+	template<> inline constexpr long double twoBySqrtPi<long double> = 1.12837916709551257389615890312154517L;
+	template<> inline constexpr long double sqrt2<long double> = 1.41421356237309504880168872420969808L;
+	template<> inline constexpr long double oneBySqrt2<long double> = 0.707106781186547524400844362104849039L;
+
+#ifdef __SHLUBLU_FLOAT128
+	template<> inline constexpr __float128 e<__float128> = 2.71828182845904523536028747135266250Q;
+	template<> inline constexpr __float128 log2e<__float128> = 1.44269504088896340735992468100189214Q;
+	template<> inline constexpr __float128 log10e<__float128> = 0.434294481903251827651128918916605082Q;
+	template<> inline constexpr __float128 ln2<__float128> = 0.693147180559945309417232121458176568Q;
+	template<> inline constexpr __float128 ln10<__float128> = 2.30258509299404568401799145468436421Q;
+	template<> inline constexpr __float128 pi<__float128> = 3.14159265358979323846264338327950288Q;
+	template<> inline constexpr __float128 piBy2<__float128> = 1.57079632679489661923132169163975144Q;
+	template<> inline constexpr __float128 piBy4<__float128> = 0.785398163397448309615660845819875721Q;
+	template<> inline constexpr __float128 oneByPi<__float128> = 0.318309886183790671537767526745028724Q;
+	template<> inline constexpr __float128 twoByPi<__float128> = 0.636619772367581343075535053490057448Q;
+	template<> inline constexpr __float128 twoBySqrtPi<__float128> = 1.12837916709551257389615890312154517Q;
+	template<> inline constexpr __float128 sqrt2<__float128> = 1.41421356237309504880168872420969808Q;
+	template<> inline constexpr __float128 oneBySqrt2<__float128> = 0.707106781186547524400844362104849039Q;
+#endif
+
+	/// @endcond
+
+
+	/**
+		Constant \f$e\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$e\f$
+		@see e
+	*/
+	template<typename T> constexpr T constantE()
+	{
+		return e<T>;
+	}
+
+	/**
+		Constant \f$log2(e)\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$log2(e)\f$
+		@see log2e
+	*/
+	template<typename T> constexpr T constantLog2e()
+	{
+		return log2e<T>;
+	}
+
+	/**
+		Constant \f$log10(e)\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$log10(e)\f$
+		@see log10e
+	*/
+	template<typename T> constexpr T constantLog10e()
+	{
+		return log10e<T>;
+	}
+
+	/**
+		Constant \f$ln(2)\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$ln(2)\f$
+		@see ln2
+	*/
+	template<typename T> constexpr T constantLn2()
+	{
+		return ln2<T>;
+	}
+
+	/**
+		Constant \f$ln(10)\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$ln(10)\f$
+		@see ln10
+	*/
+	template<typename T> constexpr T constantLn10()
+	{
+		return ln10<T>;
+	}
+
+	/**
+		Constant \f$\pi\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$\pi\f$
+		@see pi
+	*/
+	template<typename T> constexpr T constantPi()
+	{
+		return pi<T>;
+	}
+
+	/**
+		Constant \f$\pi / 2\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$\pi / 2\f$
+		@see piBy2
+	*/
+	template<typename T> constexpr T constantPiBy2()
+	{
+		return piBy2<T>;
+	}
+
+	/**
+		Constant \f$\pi / 4\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$\pi / 4\f$
+		@see piBy4
+	*/
+	template<typename T> constexpr T constantPiBy4()
+	{
+		return piBy4<T>;
+	}
+
+	/**
+		Constant \f$1 / \pi\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$1 / \pi\f$
+		@see oneByPi
+	*/
+	template<typename T> constexpr T constant1ByPi()
+	{
+		return oneByPi<T>;
+	}
+
+	/**
+		Constant \f$2 / \pi\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$2 / \pi\f$
+		@see twoByPi
+	*/
+	template<typename T> constexpr T constant2ByPi()
+	{
+		return twoByPi<T>;
+	}
+
+	/**
+		Constant \f$2 / \sqrt{\pi}\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$2 / \sqrt{\pi}\f$
+		@see twoBySqrtPi
+	*/
+	template<typename T> constexpr T constant2BySqrtPi()
+	{
+		return twoBySqrtPi<T>;
+	}
+
+	/**
+		Constant \f$\sqrt{2}\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$\sqrt{2}\f$
+		@see sqrt2
+	*/
+	template<typename T> constexpr T constantSqrt2()
+	{
+		return sqrt2<T>;
+	}
+
+	/**
+		Constant \f$1 / \sqrt{2}\f$.
+		As per the legacy `<math.h>` C header.
+		@tparam T the type of the returned value. This type should be floating point.
+		@return \f$1 / \sqrt{2}\f$
+		@see oneBySqrt2
+	*/
+	template<typename T> constexpr T constant1BySqrt2()
+	{
+		return oneBySqrt2<T>;
+	}
+
+
+	/**
+		Maximal value that can be incremented to give a different value.
+		Determined as \f$f + 1 \neq f\f$.
+		@tparam T the type to apply this function to. This type should be floating point.
+		@return the value applicable to `T`
+
+		@note Linux `long double` is currently handled as `double` though it would support higher values.
+	*/
+	template<typename T> constexpr T constantMaxIncrementable()
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+		return 9007199254740991.0; 
+	}
+	
+
+	/// @cond INTERNAL
+	template<> constexpr float constantMaxIncrementable()
+	{
+		return 16777215.0f;
+	}
+	/// @endcond 
+
+
+	/**
+		Minimal value that can be decremented to give a different value.
+		Determined as \f$f - 1 \neq f\f$.
+		@tparam T the type to apply this function to. This type should be floating point.
+		@return the value applicable to `T`
+
+		@note Linux `long double` is currently handled as `double` though it would support lower values.
+	*/
+	template<typename T> constexpr T constantMinDecrementable()
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+		return -constantMaxIncrementable<T>();
+	}
+
+	   
+	/**
+		Tells whether `x` and `y` are of the same sign.
+		
+		@tparam the type of `x` and `y`. This type should be arithmetic.
+		@param x a value
+		@param y another value
+		@return `true` if `x` and `y` are of the same sign, `false` otherwise
+	*/
+	template<typename T> bool sameSign(T x, T y)
+	{
+		static_assert(std::is_arithmetic<T>::value, "Type should be arithmetic.");
+
+		return (x >= T(0)) ^ (y < T(0));
+	}
+
+
+	/**
+		Tells, for each pair of elements of `x` and `y`, whether they are of the same sign.
+		This function uses AVX2 instructions when the CPU supports them.
+
+		@param x an array of values
+		@param y another array of values
+		@param dest the array to write the results to. `dest[i]` receives `sameSign(x[i], y[i])`.
+		@param count the number of elements of `x`, `y` and `dest`
+		@see sameSign(T, T)
+	*/
+	void sameSign(float const* x, float const* y, bool* dest, size_t count);
+
+	/**
+		Tells, for each pair of elements of `x` and `y`, whether they are of the same sign.
+		@see sameSign(float const*, float const*, bool*, size_t)
+	*/
+	void sameSign(double const* x, double const* y, bool* dest, size_t count);
+
+
+	/**
+		Clamps a value to a range.
+		@tparam T The type of the value and the range. This type should be non-boolean arithmetic.
+		@param value the value to clamp
+		@param minVal the lower inclusive bound of the range
+		@param maxVal the upper inclusive bound of the range
+		@return `value` if \f$value \in [minVal, maxVal]\f$, `minVal` if \f$value < minVal\f$, and `maxVal` if \f$value > maxVal\f$
+		@exception std::invalid_argument if `minVal > maxVal`
+	*/
+	template<typename T> T clamp(T value, T minVal, T maxVal)
+	{
+		static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Type should be non-boolean arithmetic.");
+
+		if (minVal > maxVal)
+		{
+			throw std::invalid_argument("Math::clamp(): " + String::xtos(minVal) + " > " + String::xtos(maxVal));
+		}
+
+		return std::max<T>(minVal, std::min<T>(value, maxVal));
+	}
+
+
+	/**
+		Clamps values to a range.
+		This function uses AVX2 instructions when the CPU supports them.
+
+		@param values the values to clamp
+		@param dest the array to write the results to. `dest[i]` receives `clamp(values[i], minVal, maxVal)`. It can be `values`.
+		@param count the number of elements of `values` and `dest`
+		@param minVal the lower inclusive bound of the range
+		@param maxVal the upper inclusive bound of the range
+		@exception std::invalid_argument if `minVal > maxVal`
+		@see clamp(T, T, T)
+	*/
+	void clamp(float const* values, float* dest, size_t count, float minVal, float maxVal);
+
+	/**
+		Clamps values to a range.
+		@see clamp(float const*, float*, size_t, float, float)
+	*/
+	void clamp(double const* values, double* dest, size_t count, double minVal, double maxVal);
+
+
+	/// @cond INTERNAL
+	constexpr long double __powersOfTen[] =
+	{
+		1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 1e10L, 1e11L,
+		1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 1e20L, 1e21L, 1e22L
+	};
+	/// @endcond
+
+
+	/**
+		Returns \f$10^n\f$.
+		Values up to \f$10^{22}\f$, which are exactly representable by `double`, are read from a table. This function can be used in constant
+		expressions within this range. Greater values are computed by `std::pow()`.
+		@tparam T the type of the returned value. This type should be floating point.
+		@param n the exponent
+		@return \f$10^n\f$
+	*/
+	template<typename T> constexpr T powerOfTen(size_t n)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		return (n < sizeof(__powersOfTen) / sizeof(__powersOfTen[0])) ? T(__powersOfTen[n]) : std::pow(T(10.0), T(n));
+	}
+
+
+	/**
+		Rounds a number to the specified number of fractional digits.
+		Halfway cases are rounded away from zero, as `std::round()` does.
+		@tparam T the type of the number to round and of the returned value. This type should be floating point.
+		@param number the number to round
+		@param digits the number of fractional digits to round `number` to
+		@return the rounded value of `number`
+	*/
+	template<typename T> T roundX(T number, size_t digits)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+		
+		const T factor(powerOfTen<T>(digits));
+
+		return std::round(factor * number) / factor;
+	}
+
+
+	/// @cond INTERNAL
+	// Same result as std::round(), without its library call. 0.5 - epsilon / 4 is the greatest value below 0.5: adding it rounds
+	// halfway cases away from zero, and cannot carry the others to the next integer.
+	template<typename T> T __roundHalfAwayFromZero(T x)
+	{
+		constexpr T belowHalf(T(0.5) - std::numeric_limits<T>::epsilon() / T(4));
+
+		return std::trunc(x + std::copysign(belowHalf, x));
+	}
+	/// @endcond
+
+
+	/**
+		Rounds numbers in place to the specified number of fractional digits.
+		The scaling factor is computed once. Results are those of roundX(T, size_t).
+		@tparam T the type of the numbers to round. This type should be floating point.
+		@param numbers the numbers to round
+		@param count the number of elements of `numbers`
+		@param digits the number of fractional digits to round `numbers` to
+		@see roundX(T, size_t)
+		@see roundX(double*, size_t, size_t) for `float` and `double`, which use AVX2 instructions when the CPU supports them
+	*/
+	template<typename T> void roundX(T* numbers, size_t count, size_t digits)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		const T factor(powerOfTen<T>(digits));
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			numbers[i] = __roundHalfAwayFromZero(factor * numbers[i]) / factor;
+		}
+	}
+
+
+	/**
+		Rounds numbers in place to the specified number of fractional digits.
+		Uses AVX2 instructions when the CPU supports them. Results are those of roundX(T, size_t).
+		@param numbers the numbers to round
+		@param count the number of elements of `numbers`
+		@param digits the number of fractional digits to round `numbers` to
+		@see roundX(T, size_t)
+	*/
+	void roundX(double* numbers, size_t count, size_t digits);
+
+	/**
+		Rounds numbers in place to the specified number of fractional digits.
+		@see roundX(double*, size_t, size_t)
+	*/
+	void roundX(float* numbers, size_t count, size_t digits);
+
+
+	/**
+		Rounds numbers in place to the specified number of fractional digits.
+		@tparam T the type of the numbers to round. This type should be floating point.
+		@param numbers the numbers to round
+		@param digits the number of fractional digits to round `numbers` to
+		@see roundX(T*, size_t, size_t)
+	*/
+	template<typename T> void roundX(std::vector<T>& numbers, size_t digits)
+	{
+		roundX(numbers.data(), numbers.size(), digits);
+	}
+
+
+	/**
+		Rounds a number to 2 fractional digits.
+		@tparam T the type of the number to round and of the returned value. This type should be floating point.
+		@param number the number to round
+		@return the rounded value of `number`
+		@see roundX()
+	*/
+	template<typename T> T round2(T number)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		constexpr T factor(powerOfTen<T>(2));
+
+		return std::round(factor * number) / factor;
+	}
+
+
+	/**
+		Rounds numbers in place to 2 fractional digits.
+		@tparam T the type of the numbers to round. This type should be floating point.
+		@param numbers the numbers to round
+		@param count the number of elements of `numbers`
+		@see roundX(T*, size_t, size_t)
+	*/
+	template<typename T> void round2(T* numbers, size_t count)
+	{
+		roundX(numbers, count, 2);
+	}
+
+
+	/**
+		Rounds numbers in place to 2 fractional digits.
+		@tparam T the type of the numbers to round. This type should be floating point.
+		@param numbers the numbers to round
+		@see roundX(T*, size_t, size_t)
+	*/
+	template<typename T> void round2(std::vector<T>& numbers)
+	{
+		roundX(numbers.data(), numbers.size(), 2);
+	}
+
+
+	/// @cond INTERNAL
+	constexpr size_t __sumLanes(4); // independent accumulators, which the compiler can map to SIMD lanes
+	constexpr size_t __pairwiseSumBlockSize(128);
+	constexpr size_t __compensatedSumRenormalizationPeriod(1024);
+
+
+	template<typename T> struct __CompensatedAccumulator
+	{
+		T sum[__sumLanes];
+		T compensation[__sumLanes];
+	};
+
+
+	// Neumaier's variant of Kahan's compensated summation: the compensation stays correct when the addend is larger than the sum.
+	// The rounding error of the addition is computed by Knuth's TwoSum, which has no branch.
+	template<typename T> inline void __compensatedAdd(T& sum, T& compensation, T x)
+	{
+		const T t(sum + x);
+		const T z(t - sum);
+
+		compensation += (sum - (t - z)) + (x - z);
+		sum = t;
+	}
+
+
+	// Moves the compensations into the sums, which keeps the compensations small and their own rounding errors negligible
+	template<typename T> void __compensatedRenormalize(__CompensatedAccumulator<T>& acc)
+	{
+		for (size_t lane = 0; lane < __sumLanes; ++lane)
+		{
+			T compensation(0);
+
+			__compensatedAdd(acc.sum[lane], compensation, acc.compensation[lane]);
+			acc.compensation[lane] = compensation;
+		}
+	}
+
+
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+	constexpr bool __fmaIsFast(true);
+#else
+	constexpr bool __fmaIsFast(false);
+#endif
+
+
+	// Exact rounding error of a product, given its rounded value. std::fma() is only used when it is a single instruction: otherwise it is a
+	// library call, and Dekker's product, whose factors are split by Veltkamp's method so that the products of their halves are exact, is faster.
+	template<typename T> T __productError(T a, T b, T product)
+	{
+		T ret;
+
+		if (__fmaIsFast && !std::is_same<T, long double>::value)
+		{
+			ret = std::fma(a, b, -product);
+		}
+		else
+		{
+			constexpr T splitter(T((uint64_t(1) << ((std::numeric_limits<T>::digits + 1) / 2)) + 1));
+
+			const T aScaled(splitter * a);
+			const T aHigh(aScaled - (aScaled - a));
+			const T aLow(a - aHigh);
+			const T bScaled(splitter * b);
+			const T bHigh(bScaled - (bScaled - b));
+			const T bLow(b - bHigh);
+
+			ret = ((aHigh * bHigh - product) + aHigh * bLow + aLow * bHigh) + aLow * bLow;
+		}
+
+		return ret;
+	}
+
+
+	template<typename T> T __compensatedResult(__CompensatedAccumulator<T> const& acc)
+	{
+		T sum(0);
+		T compensation(0);
+
+		for (size_t lane = 0; lane < __sumLanes; ++lane)
+		{
+			__compensatedAdd(sum, compensation, acc.sum[lane]);
+			compensation += acc.compensation[lane];
+		}
+
+		return sum + compensation;
+	}
+	/// @endcond
+
+
+	/**
+		Returns the sum of values using pairwise summation.
+		The rounding error grows as \f$O(\epsilon \log n)\f$ instead of \f$O(\epsilon n)\f$ for a plain loop, for about the same speed.
+		Blocks of values are summed with independent accumulators so that the loop can be vectorized.
+
+		@tparam T the type of the values. This type should be floating point.
+		@param values the values to sum
+		@param count the number of elements of `values`
+		@return the sum of `values`, or zero if `count` is zero
+		@see compensatedSum()
+	*/
+	template<typename T> T sum(T const* values, size_t count)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		T ret(0);
+
+		if (count <= __pairwiseSumBlockSize)
+		{
+			T lanes[__sumLanes] = {};
+			size_t i(0);
+
+			for (; i + __sumLanes <= count; i += __sumLanes)
+			{
+				for (size_t lane = 0; lane < __sumLanes; ++lane)
+				{
+					lanes[lane] += values[i + lane];
+				}
+			}
+
+			for (; i < count; ++i)
+			{
+				lanes[0] += values[i];
+			}
+
+			ret = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+		}
+		else
+		{
+			// Splitting on a block boundary keeps the leaves full
+			const size_t half(((count / 2 + __pairwiseSumBlockSize - 1) / __pairwiseSumBlockSize) * __pairwiseSumBlockSize);
+
+			ret = sum(values, half) + sum(values + half, count - half);
+		}
+
+		return ret;
+	}
+
+
+	/**
+		Returns the sum of values using pairwise summation.
+		@tparam T the type of the values. This type should be floating point.
+		@param values the values to sum
+		@return the sum of `values`
+		@see sum(T const*, size_t)
+	*/
+	template<typename T> T sum(std::vector<T> const& values)
+	{
+		return sum(values.data(), values.size());
+	}
+
+
+	/**
+		Returns the sum of values using compensated summation.
+		This is Neumaier's improvement of Kahan's algorithm: the rounding error is \f$O(\epsilon)\f$ relative to \f$\sum|x_i|\f$ whatever
+		the number of values, and cancellations such as `1e100 + 1.0 - 1e100` give the exact result.
+		Several independent compensated accumulators are used so that the loop can be vectorized. Their compensations are periodically moved
+		into their sums, so that the error of the compensations themselves does not grow with the number of values.
+
+		@tparam T the type of the values. This type should be floating point.
+		@param values the values to sum
+		@param count the number of elements of `values`
+		@return the sum of `values`, or zero if `count` is zero
+		@see sum()
+	*/
+	template<typename T> T compensatedSum(T const* values, size_t count)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		__CompensatedAccumulator<T> acc = {};
+		size_t i(0);
+
+		for (; i + __sumLanes <= count; i += __sumLanes)
+		{
+			for (size_t lane = 0; lane < __sumLanes; ++lane)
+			{
+				__compensatedAdd(acc.sum[lane], acc.compensation[lane], values[i + lane]);
+			}
+
+			if ((i + __sumLanes) % __compensatedSumRenormalizationPeriod == 0)
+			{
+				__compensatedRenormalize(acc);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			__compensatedAdd(acc.sum[0], acc.compensation[0], values[i]);
+		}
+
+		return __compensatedResult(acc);
+	}
+
+
+	/**
+		Returns the sum of values using compensated summation.
+		@tparam T the type of the values. This type should be floating point.
+		@param values the values to sum
+		@return the sum of `values`
+		@see compensatedSum(T const*, size_t)
+	*/
+	template<typename T> T compensatedSum(std::vector<T> const& values)
+	{
+		return compensatedSum(values.data(), values.size());
+	}
+
+
+	/**
+		Returns the dot product of two arrays with compensated accumulation.
+		Each product is split into its rounded value and its exact rounding error, and both are accumulated as `compensatedSum()` does.
+		The result is as accurate as if it was computed with twice the precision of `T`, then rounded.
+		Rounding errors are computed by fused multiply-add instructions when the target has them, and by Dekker's algorithm otherwise.
+		The latter requires the magnitude of the factors to be lower than \f$max(T) / 2^{\lceil digits(T) / 2 \rceil}\f$, about \f$10^{300}\f$ for `double`.
+
+		@tparam T the type of the values. This type should be floating point.
+		@param a the first array
+		@param b the second array
+		@param count the number of elements of `a` and `b`
+		@return \f$\sum a_i b_i\f$, or zero if `count` is zero
+		@see dot(double const*, double const*, size_t) for `float` and `double`, which use AVX2 and FMA instructions when the CPU supports them
+	*/
+	template<typename T> T dot(T const* a, T const* b, size_t count)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		__CompensatedAccumulator<T> acc = {};
+		size_t i(0);
+
+		for (; i + __sumLanes <= count; i += __sumLanes)
+		{
+			for (size_t lane = 0; lane < __sumLanes; ++lane)
+			{
+				const T product(a[i + lane] * b[i + lane]);
+
+				__compensatedAdd(acc.sum[lane], acc.compensation[lane], product);
+				acc.compensation[lane] += __productError(a[i + lane], b[i + lane], product);
+			}
+
+			if ((i + __sumLanes) % __compensatedSumRenormalizationPeriod == 0)
+			{
+				__compensatedRenormalize(acc);
+			}
+		}
+
+		for (; i < count; ++i)
+		{
+			const T product(a[i] * b[i]);
+
+			__compensatedAdd(acc.sum[0], acc.compensation[0], product);
+			acc.compensation[0] += __productError(a[i], b[i], product);
+		}
+
+		return __compensatedResult(acc);
+	}
+
+
+	/**
+		Returns the dot product of two arrays with compensated accumulation.
+		Uses AVX2 and FMA instructions when the CPU supports them. The accuracy is that of dot(T const*, T const*, size_t), whose limitation
+		on the magnitude of the factors only applies when these instructions are not available.
+		@param a the first array
+		@param b the second array
+		@param count the number of elements of `a` and `b`
+		@return \f$\sum a_i b_i\f$, or zero if `count` is zero
+		@see dot(T const*, T const*, size_t)
+	*/
+	double dot(double const* a, double const* b, size_t count);
+
+	/**
+		Returns the dot product of two arrays with compensated accumulation.
+		@see dot(double const*, double const*, size_t)
+	*/
+	float dot(float const* a, float const* b, size_t count);
+
+
+	/**
+		Returns the dot product of two vectors with compensated accumulation.
+		@tparam T the type of the values. This type should be floating point.
+		@param a the first vector
+		@param b the second vector
+		@return \f$\sum a_i b_i\f$
+		@exception std::invalid_argument if `a` and `b` are not of the same size
+		@see dot(T const*, T const*, size_t)
+	*/
+	template<typename T> T dot(std::vector<T> const& a, std::vector<T> const& b)
+	{
+		if (a.size() != b.size())
+		{
+			throw std::invalid_argument("Math::dot(): sizes differ (" + String::xtos(a.size()) + " and " + String::xtos(b.size()) + ").");
+		}
+
+		return dot(a.data(), b.data(), a.size());
+	}
+
+
+	/// @cond INTERNAL
+	constexpr double __fastRoundingMagic(6755399441055744.0); // 1.5 * 2^52: adding then subtracting it rounds to the nearest integer
+	constexpr double __fastLn2Hi(6.93147180369123816490e-01); // 32 significant bits: its products with exponents are exact
+	constexpr double __fastLn2Lo(1.90821492927058770002e-10);
+	constexpr double __fastMinExpArgument(-746.0); // exp() underflows to zero below, and overflows above the maximum
+	constexpr double __fastMaxExpArgument(710.0);
+
+
+	// 2^n for an integral n within [-1022, 1023]
+	inline double __fastPowerOfTwo(double n)
+	{
+		const uint64_t bits(uint64_t(int64_t(n) + 1023) << 52);
+		double ret;
+
+		std::memcpy(&ret, &bits, sizeof(ret));
+
+		return ret;
+	}
+
+
+	// exp(x) = 2^n exp(r) with r within [-ln(2)/2, ln(2)/2], exp(r) being given by its degree 7 Taylor expansion evaluated with Estrin's scheme.
+	// 2^n is applied in two steps so that results may be subnormal.
+	inline double __fastExp(double x)
+	{
+		if (std::isnan(x))
+		{
+			return x;
+		}
+
+		const double clamped(std::min(std::max(x, __fastMinExpArgument), __fastMaxExpArgument));
+		const double n((clamped * log2e<double> + __fastRoundingMagic) - __fastRoundingMagic);
+		const double r((clamped - n * __fastLn2Hi) - n * __fastLn2Lo);
+		const double r2(r * r);
+		const double r4(r2 * r2);
+		const double p(((1.0 + r) + r2 * (1.0 / 2.0 + r * (1.0 / 6.0))) + r4 * ((1.0 / 24.0 + r * (1.0 / 120.0)) + r2 * (1.0 / 720.0 + r * (1.0 / 5040.0))));
+		const double half(std::floor(n * 0.5));
+
+		return p * __fastPowerOfTwo(half) * __fastPowerOfTwo(n - half);
+	}
+
+
+	// log(x) = k ln(2) + log(m) with m within [sqrt(2)/2, sqrt(2)], log(m) being given by the series of 2 atanh(s), s = (m - 1) / (m + 1)
+	inline double __fastLog(double x)
+	{
+		if (!(x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max()))
+		{
+			return std::log(x);
+		}
+
+		uint64_t bits;
+		std::memcpy(&bits, &x, sizeof(bits));
+
+		const uint64_t mantissaBits((bits & 0x000FFFFFFFFFFFFFULL) | 0x3FF0000000000000ULL);
+		double m;
+		std::memcpy(&m, &mantissaBits, sizeof(m));
+
+		double k(double(int64_t(bits >> 52)) - 1023.0);
+
+		if (m > 1.41421356237309504880)
+		{
+			m *= 0.5;
+			k += 1.0;
+		}
+
+		const double f(m - 1.0);
+		const double s(f / (2.0 + f));
+		const double z(s * s);
+		const double z2(z * z);
+		const double series(2.0 * s * ((1.0 + z * (1.0 / 3.0)) + z2 * ((1.0 / 5.0 + z * (1.0 / 7.0)) + z2 * (1.0 / 9.0))));
+
+		return k * __fastLn2Hi + (k * __fastLn2Lo + series);
+	}
+
+
+	inline double __fastPow(double x, double y)
+	{
+		const bool fastPath(x >= std::numeric_limits<double>::min() && x <= std::numeric_limits<double>::max() && std::abs(y) <= std::numeric_limits<double>::max());
+
+		return fastPath ? __fastExp(y * __fastLog(x)) : std::pow(x, y);
+	}
+
+
+	inline double __fastSigmoid(double x)
+	{
+		return 1.0 / (1.0 + __fastExp(-x));
+	}
+	/// @endcond
+
+
+	/**
+		Fast approximation of \f$e^x\f$.
+		This function trades accuracy for speed: its relative error is below \f$10^{-8}\f$, and its results converted to `float` are within one ulp of the exact value.
+		It is computed with `double` precision whatever `T`. Infinite and NaN arguments give the same results as `std::exp()`.
+
+		@tparam T the type of the argument and of the result. This type should be floating point.
+		@param x the exponent
+		@return an approximation of \f$e^x\f$
+		@see fastExp(double const*, double*, size_t)
+	*/
+	template<typename T> inline T fastExp(T x)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		return T(__fastExp(double(x)));
+	}
+
+
+	/**
+		Fast approximation of \f$\ln(x)\f$.
+		This function trades accuracy for speed: its absolute error is below \f$10^{-9}\f$, its relative error is below \f$10^{-8}\f$,
+		and its results converted to `float` are within one ulp of the exact value. It is computed with `double` precision whatever `T`.
+		Arguments that are zero, negative, subnormal, infinite or NaN are handled by `std::log()`.
+
+		@tparam T the type of the argument and of the result. This type should be floating point.
+		@param x the argument
+		@return an approximation of \f$\ln(x)\f$
+		@see fastLog(double const*, double*, size_t)
+	*/
+	template<typename T> inline T fastLog(T x)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		return T(__fastLog(double(x)));
+	}
+
+
+	/**
+		Fast approximation of \f$x^y\f$.
+		This function computes \f$e^{y \ln(x)}\f$ using `fastExp()` and `fastLog()`. Its relative error is below \f$10^{-8}(1 + |y \ln(x)|)\f$:
+		the error of the logarithm is multiplied by `y`. It is computed with `double` precision whatever `T`.
+		Arguments `x` that are zero, negative, subnormal, infinite or NaN, and infinite or NaN arguments `y`, are handled by `std::pow()`.
+
+		@tparam T the type of the arguments and of the result. This type should be floating point.
+		@param x the base
+		@param y the exponent
+		@return an approximation of \f$x^y\f$
+		@see fastPow(double const*, double const*, double*, size_t)
+	*/
+	template<typename T> inline T fastPow(T x, T y)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		return T(__fastPow(double(x), double(y)));
+	}
+
+
+	/**
+		Fast approximation of the logistic function \f$\frac{1}{1 + e^{-x}}\f$.
+		This function uses `fastExp()`. Its relative error is below \f$10^{-8}\f$. It is computed with `double` precision whatever `T`.
+
+		@tparam T the type of the argument and of the result. This type should be floating point.
+		@param x the argument
+		@return an approximation of \f$\frac{1}{1 + e^{-x}}\f$
+		@see fastSigmoid(double const*, double*, size_t)
+	*/
+	template<typename T> inline T fastSigmoid(T x)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		return T(__fastSigmoid(double(x)));
+	}
+
+
+	/**
+		Computes fast approximations of \f$e^x\f$ for an array of values.
+		This function uses AVX2 instructions when the CPU supports them. Its results are those of `fastExp(T)`.
+
+		@param x the exponents
+		@param dest the array to write the results to. It can be `x`.
+		@param count the number of elements of `x` and `dest`
+		@see fastExp(T)
+	*/
+	void fastExp(float const* x, float* dest, size_t count);
+
+	/**
+		Computes fast approximations of \f$e^x\f$ for an array of values.
+		@see fastExp(float const*, float*, size_t)
+	*/
+	void fastExp(double const* x, double* dest, size_t count);
+
+
+	/**
+		Computes fast approximations of \f$\ln(x)\f$ for an array of values.
+		This function uses AVX2 instructions when the CPU supports them. Its results are those of `fastLog(T)`.
+
+		@param x the arguments
+		@param dest the array to write the results to. It can be `x`.
+		@param count the number of elements of `x` and `dest`
+		@see fastLog(T)
+	*/
+	void fastLog(float const* x, float* dest, size_t count);
+
+	/**
+		Computes fast approximations of \f$\ln(x)\f$ for an array of values.
+		@see fastLog(float const*, float*, size_t)
+	*/
+	void fastLog(double const* x, double* dest, size_t count);
+
+
+	/**
+		Computes fast approximations of \f$x^y\f$ for arrays of bases and exponents.
+		This function uses AVX2 instructions when the CPU supports them. Its results are those of `fastPow(T, T)`.
+
+		@param x the bases
+		@param y the exponents
+		@param dest the array to write the results to. `dest[i]` receives `fastPow(x[i], y[i])`. It can be `x` or `y`.
+		@param count the number of elements of `x`, `y` and `dest`
+		@see fastPow(T, T)
+	*/
+	void fastPow(float const* x, float const* y, float* dest, size_t count);
+
+	/**
+		Computes fast approximations of \f$x^y\f$ for arrays of bases and exponents.
+		@see fastPow(float const*, float const*, float*, size_t)
+	*/
+	void fastPow(double const* x, double const* y, double* dest, size_t count);
+
+
+	/**
+		Computes fast approximations of the logistic function for an array of values.
+		This function uses AVX2 instructions when the CPU supports them. Its results are those of `fastSigmoid(T)`.
+
+		@param x the arguments
+		@param dest the array to write the results to. It can be `x`.
+		@param count the number of elements of `x` and `dest`
+		@see fastSigmoid(T)
+	*/
+	void fastSigmoid(float const* x, float* dest, size_t count);
+
+	/**
+		Computes fast approximations of the logistic function for an array of values.
+		@see fastSigmoid(float const*, float*, size_t)
+	*/
+	void fastSigmoid(double const* x, double* dest, size_t count);
+
+
+	/// @cond INTERNAL
+	template<typename T> constexpr size_t __factorialTableSize()
+	{
+		T f(1);
+		size_t n(1);
+
+		while (f <= std::numeric_limits<T>::max() / T(n))
+		{
+			f *= T(n);
+			++n;
+		}
+
+		return n;
+	}
+
+
+	template<typename T, size_t N> constexpr std::array<T, N> __factorialTable()
+	{
+		std::array<T, N> ret{};
+		ret[0] = T(1);
+
+		for (size_t n = 1; n < N; ++n)
+		{
+			ret[n] = ret[n - 1] * T(n);
+		}
+
+		return ret;
+	}
+
+
+	template<typename T> struct __FactorialTable
+	{
+		static constexpr size_t size = __factorialTableSize<T>();
+		static constexpr std::array<T, size> values = __factorialTable<T, size>();
+	};
+	/// @endcond
+
+
+	/**
+		Returns the factorial of a given number.
+		This function is only defined for \f$n \in \mathbb{N+}\f$
+
+		Results are read from a table computed at compile time, which contains all the factorials `T` can represent.
+		This function can be used in constant expressions.
+
+		@tparam T the type of `n` and of the returned value
+		@param n the number whose factorial is to be calculated
+		@return the factorial of `n`
+		@exception std::domain_error if \f$n \notin \mathbb{N+}\f$
+		@exception std::overflow_error if the factorial of `n` cannot be represented by `T`
+		@see logFactorial()
+	*/
+	template<typename T> constexpr T factorial(T n)
+	{
+		static_assert(std::is_arithmetic<T>::value && !std::is_same<T, bool>::value, "Type should be arithmetic.");
+
+		if (n < T(0))
+		{
+			throw std::domain_error("Math::factorial(): " + String::xtos(n) + " is negative.");
+		}
+
+		if constexpr (std::is_floating_point<T>::value)
+		{
+			if (n != n)
+			{
+				throw std::domain_error("Math::factorial(): " + String::xtos(n) + " is not a number.");
+			}
+		}
+
+		if (n >= T(__FactorialTable<T>::size))
+		{
+			throw std::overflow_error("Math::factorial(): " + String::xtos(n) + "! cannot be represented by this type.");
+		}
+
+		const size_t index(static_cast<size_t>(n));
+
+		if (T(index) != n)
+		{
+			throw std::domain_error("Math::factorial(): " + String::xtos(n) + " is not round.");
+		}
+
+		return __FactorialTable<T>::values[index];
+	}
+
+
+	/**
+		Returns the natural logarithm of the factorial of a given number.
+		This function is only defined for \f$n \in \mathbb{N+}\f$. It is based on <a href="https://www.cplusplus.com/reference/cmath/lgamma/">std::lgamma</a>,
+		which makes it suitable to numbers whose factorial would overflow.
+
+		@tparam T the type of `n` and of the returned value. This type should be floating point.
+		@param n the number whose factorial logarithm is to be calculated
+		@return \f$ln(n!)\f$
+		@exception std::domain_error if \f$n \notin \mathbb{N+}\f$
+	*/
+	template<typename T> T logFactorial(T n)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		if (n < T(0))
+		{
+			throw std::domain_error("Math::logFactorial(): " + String::xtos(n) + " is negative.");
+		}
+
+		if (std::round(n) != n)
+		{
+			throw std::domain_error("Math::logFactorial(): " + String::xtos(n) + " is not round.");
+		}
+
+		return std::lgamma(n + T(1));
+	}
+
+
+	/// @cond INTERNAL
+	template<typename T> constexpr T __multiplyChecked(T x, T y, const char* caller)
+	{
+		if (x != T(0) && y > std::numeric_limits<T>::max() / x)
+		{
+			throw std::overflow_error(std::string(caller) + ": " + String::xtos(x) + " * " + String::xtos(y) + " cannot be represented by this type.");
+		}
+
+		return x * y;
+	}
+	/// @endcond
+
+
+	/**
+		Returns the binomial coefficient \f$\binom{n}{k}\f$, which is the number of k-combinations of a set of n elements.
+		This function is only defined for \f$n, k \in \mathbb{N+}\f$. It returns zero if \f$k > n\f$.
+
+		The multiplicative formula \f$\binom{n}{k} = \prod_{i=1}^{k} \frac{n - k + i}{i}\f$ is used, each intermediate result being divided by its
+		greatest common divisor with `i` beforehand. Intermediate results never exceed the final one, so that an overflow only occurs if the result itself
+		cannot be represented by `T`. This function can be used in constant expressions.
+
+		@tparam T the type of `n`, `k` and of the returned value. This type should be integral.
+		@param n the number of elements of the set
+		@param k the number of elements to choose
+		@return the binomial coefficient \f$\binom{n}{k}\f$
+		@exception std::domain_error if `n` or `k` is negative
+		@exception std::overflow_error if the result cannot be represented by `T`
+		@see cachedBinomial()
+	*/
+	template<typename T> constexpr T binomial(T n, T k)
+	{
+		static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "Type should be integral.");
+
+		if (n < T(0) || k < T(0))
+		{
+			throw std::domain_error("Math::binomial(): " + String::xtos(n) + " and " + String::xtos(k) + " should be positive.");
+		}
+
+		T ret(k > n ? 0 : 1);
+
+		if (ret)
+		{
+			k = std::min<T>(k, T(n - k));
+
+			for (T i = 1; i <= k; ++i)
+			{
+				const T divisor(std::gcd(ret, i));
+
+				// (n - k + i) is a multiple of (i / divisor) as ret * (n - k + i) is a multiple of i
+				ret = __multiplyChecked(T(ret / divisor), T((n - k + i) / (i / divisor)), "Math::binomial()");
+			}
+		}
+
+		return ret;
+	}
+
+
+	/**
+		Returns the binomial coefficient \f$\binom{n}{k}\f$ from a Pascal triangle shared by all threads.
+		The triangle is extended up to the row `n` at the first query that needs it, and then queries to lower rows are simple lookups. 
+		Only the rows whose entries can all be represented by `size_t` are stored, which is up to \f$n = 67\f$ with a 64-bit `size_t`:
+		queries to greater rows are given to `binomial()`.
+
+		This function is thread-safe.
+
+		@param n the number of elements of the set
+		@param k the number of elements to choose
+		@return the binomial coefficient \f$\binom{n}{k}\f$, or zero if \f$k > n\f$
+		@exception std::overflow_error if the result cannot be represented by `size_t`
+		@see binomial()
+	*/
+	size_t cachedBinomial(size_t n, size_t k);
+
+
+	/**
+		Returns the proportional increase from an initial value to a final value.
+		The increase `I` is defined as \f$Vfinal = Vinitial + (Vinitial \times I)\f$, leading to \f$I = (Vfinal / Vinitial) - 1\f$. 
+		
+		If `I` be negative, this is a decrease. 
+
+		@tparam VALUES_TYPE the type of the initial and final values. This type should be arithmetic.
+		@tparam INCREASE_TYPE the type of the resulting increase. This type should be floating point.
+		@param initialValue the initial value
+		@param finalValue the final value
+		@return The proportional increase \f$(Vfinal / Vinitial) - 1\f$. `initialValue` is converted to `INCREASE_TYPE` to ensure this is a floating point division.
+		@exception std::invalid_argument if `initialValue` is zero
+	*/
+	template<typename VALUES_TYPE, typename INCREASE_TYPE = VALUES_TYPE> 
+	inline INCREASE_TYPE proportionalIncrease(VALUES_TYPE initialValue, VALUES_TYPE finalValue)
+	{
+		static_assert(std::is_arithmetic<VALUES_TYPE>::value, "VALUES_TYPE should be arithmetic.");
+		static_assert(std::is_floating_point<INCREASE_TYPE>::value, "INCREASE_TYPE should be floating point.");
+
+		if (initialValue == 0)
+		{
+			throw std::invalid_argument("Math::proportionalIncrease(): initialValue (" + String::xtos(initialValue) + ") should not be zero.");
+		}
+
+		return (finalValue / INCREASE_TYPE(initialValue)) - INCREASE_TYPE(1.0);
+	}
+
+
+	/**
+		Returns the proportional increases from initial values to final values.
+		This function uses AVX2 instructions when the CPU supports them.
+
+		@param initialValues the initial values
+		@param finalValues the final values
+		@param dest the array to write the results to. `dest[i]` receives `proportionalIncrease(initialValues[i], finalValues[i])`. It can be one of the inputs.
+		@param count the number of elements of `initialValues`, `finalValues` and `dest`
+		@exception std::invalid_argument if an element of `initialValues` is zero. The content of `dest` is unspecified in this case.
+		@see proportionalIncrease(VALUES_TYPE, VALUES_TYPE)
+	*/
+	void proportionalIncrease(float const* initialValues, float const* finalValues, float* dest, size_t count);
+
+	/**
+		Returns the proportional increases from initial values to final values.
+		@see proportionalIncrease(float const*, float const*, float*, size_t)
+	*/
+	void proportionalIncrease(double const* initialValues, double const* finalValues, double* dest, size_t count);
+
+
+	/**
+		Converts an proportional increase over a number of periods to an increase rate per period.
+		This is the increase rate that produces the overall increase when applied to each period.<br />
+		This rate `R` is defined as \f$(R + 1) ^ N = O + 1\f$, where `N` is the number of periods and `O` the overall increase. This leads to \f$R = \sqrt[N]{O + 1} - 1\f$. 
+
+		This function only applies to \f$O > -1\f$ as `-1` or less would correspond to a decrease of 100% or more, leading the result `R` not to be a real number. 
+
+		@tparam T the type of the overall increase and the returned rate. This type should be floating point.
+		@param overallIncrease the proportional increase over all the periods of times
+		@param numPeriods the number of periods of time that are covered
+		@return the increase rate \f$\sqrt[N]{O + 1} - 1\f$
+		@exception std::invalid_argument if `numPeriods` is zero 
+		@exception std::domain_error if `overallIncrease <= -1`
+	*/
+	template<typename T> inline T increaseRate(T overallIncrease, size_t numPeriods)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		if (numPeriods == 0)
+		{
+			throw std::invalid_argument("Math::increaseRate(): numPeriods (" + String::xtos(numPeriods) + ") should be strictly positive.");
+		}
+
+		if (overallIncrease <= T(-1.0))
+		{
+			throw std::domain_error("Math::increaseRate(): overallIncrease (" + String::xtos(overallIncrease) + ") should be greater than -1.0 for the result to be real.");
+		}
+
+		return std::pow<T>(T(1.0) + overallIncrease, T(1.0) / T(numPeriods)) - T(1.0);
+	}
+
+
+	/**
+		Converts proportional increases over a number of periods to increase rates per period.
+		When the CPU supports AVX2, this function uses vectorized logarithm and exponential approximations. The relative error of each
+		result is then below \f$(4 + 2|\ln(R + 1)|) \times 2^{-52}\f$, which is less than \f$6 \times 2^{-52}\f$ for rates between -63% and +171%,
+		or below \f$2^{-23}\f$ for `float`. Elements these approximations do not cover, such as infinite values, are processed by `increaseRate(T, size_t)`.
+
+		@param overallIncreases the proportional increases over all the periods of times
+		@param dest the array to write the results to. `dest[i]` receives `increaseRate(overallIncreases[i], numPeriods)`. It can be `overallIncreases`.
+		@param count the number of elements of `overallIncreases` and `dest`
+		@param numPeriods the number of periods of time that are covered
+		@exception std::invalid_argument if `numPeriods` is zero
+		@exception std::domain_error if an element of `overallIncreases` is `-1` or less. The content of `dest` is unspecified in this case.
+		@see increaseRate(T, size_t)
+	*/
+	void increaseRate(float const* overallIncreases, float* dest, size_t count, size_t numPeriods);
+
+	/**
+		Converts proportional increases over a number of periods to increase rates per period.
+		@see increaseRate(float const*, float*, size_t, size_t)
+	*/
+	void increaseRate(double const* overallIncreases, double* dest, size_t count, size_t numPeriods);
+
+
+	/**
+		Returns the increase rate per period giving a final value from an initial value over a given number of periods.
+
+		This rate `R` is defined as \f$Vfinal = Vinitial \times (R + 1)^N\f$ where `N` is the number of periods.
+		This leads to \f$R = \sqrt[N]{Vfinal / Vinitial} - 1\f$.
+		
+		This function only applies to:
+		<ul>
+		<li>\f$Vinitial > 0\f$ and</li>
+		<li>\f$Vfinal / Vinitial > 0\f$ as zero or less would correspond to a decrease of 100% or more, leading the result `R` not to be a real number.</li>
+		</ul>
+
+		@tparam VALUES_TYPE the type of the initial and final values. This type should be arithmetic.
+		@tparam INCREASE_TYPE the type of the resulting increase. This type should be floating point.
+		@param initialValue the initial value
+		@param finalValue the final value
+		@param numPeriods the number of periods of time that are covered
+		@return the increase rate \f$\sqrt[N]{Vfinal / Vinitial} - 1\f$
+		@exception std::invalid_argument if `initialValue` is zero or if `numPeriods` is zero 
+		@exception std::domain_error if `initialValue` is zero, or if `finalValue / initialValue <= 0`
+	*/
+	template<typename VALUES_TYPE, typename INCREASE_TYPE = VALUES_TYPE>
+	inline INCREASE_TYPE increaseRate(VALUES_TYPE initialValue, VALUES_TYPE finalValue, size_t numPeriods)
+	{
+		return increaseRate(proportionalIncrease<VALUES_TYPE, INCREASE_TYPE>(initialValue, finalValue), numPeriods);
+	}	
+
+
+	/**
+		Returns the increase rates per period giving final values from initial values over given numbers of periods.
+		When the periods are years, these are compound annual growth rates (CAGR).
+
+		The rounding error of `finalValues[i] / initialValues[i]` is compensated for, so that rates close to zero keep their relative accuracy.
+		When the CPU supports AVX2, this function uses vectorized logarithm and exponential approximations. The relative error of each
+		result is then below \f$(4 + 2|\ln(R + 1)|) \times 2^{-52}\f$, which is less than \f$6 \times 2^{-52}\f$ for rates between -63% and +171%.
+		Elements these approximations do not cover, such as infinite values, are processed by `std::log()` and `std::expm1()`.
+
+		<b>Example</b>
+		@code
+		const std::vector<double> revenues2015{ 120.0, 80.0, 45.5 };
+		const std::vector<double> revenues2020{ 190.0, 60.0, 45.5 };
+		const std::vector<size_t> years(3, 5);
+		std::vector<double> cagr(3);
+
+		Math::increaseRate(revenues2015.data(), revenues2020.data(), years.data(), cagr.data(), cagr.size()); // 0.0962..., -0.0559..., 0.0
+		@endcode
+
+		@param initialValues the initial values
+		@param finalValues the final values
+		@param numPeriods the numbers of periods of time that are covered
+		@param dest the array to write the results to. `dest[i]` receives `increaseRate(initialValues[i], finalValues[i], numPeriods[i])`. It can be `initialValues` or `finalValues`.
+		@param count the number of elements of `initialValues`, `finalValues`, `numPeriods` and `dest`
+		@exception std::invalid_argument if an element of `initialValues` or of `numPeriods` is zero. The content of `dest` is unspecified in this case.
+		@exception std::domain_error if `finalValues[i] / initialValues[i] <= 0` for some `i`. The content of `dest` is unspecified in this case.
+		@see increaseRate(VALUES_TYPE, VALUES_TYPE, size_t)
+	*/
+	void increaseRate(double const* initialValues, double const* finalValues, size_t const* numPeriods, double* dest, size_t count);
+
+
+	/**
+		Returns the value obtained by applying an increase rate to an initial value over a number of periods.
+		This value is \f$Vinitial \times (R + 1)^N\f$, where `R` is the rate and `N` the number of periods. This is the reverse of `increaseRate()`.
+
+		@tparam T the type of the values and of the rate. This type should be floating point.
+		@param initialValue the initial value
+		@param rate the increase rate per period
+		@param numPeriods the number of periods of time that are covered
+		@return the compounded value \f$Vinitial \times (R + 1)^N\f$
+		@exception std::domain_error if `rate <= -1`
+	*/
+	template<typename T> inline T compoundedValue(T initialValue, T rate, size_t numPeriods)
+	{
+		static_assert(std::is_floating_point<T>::value, "Type should be floating point.");
+
+		if (rate <= T(-1.0))
+		{
+			throw std::domain_error("Math::compoundedValue(): rate (" + String::xtos(rate) + ") should be greater than -1.0.");
+		}
+
+		return initialValue * std::pow<T>(T(1.0) + rate, T(numPeriods));
+	}
+
+
+	/**
+		Returns the values obtained by applying increase rates to initial values over numbers of periods.
+
+		When the CPU supports AVX2, this function uses vectorized logarithm and exponential approximations. The relative error of each
+		result is then below \f$(4 + 2|N \ln(R + 1)|) \times 2^{-52}\f$: the error of the logarithm is multiplied by the number of periods.
+		Elements these approximations do not cover, such as infinite values, are processed by `std::pow()`.
+
+		@param initialValues the initial values
+		@param rates the increase rates per period
+		@param numPeriods the numbers of periods of time that are covered
+		@param dest the array to write the results to. `dest[i]` receives `compoundedValue(initialValues[i], rates[i], numPeriods[i])`. It can be `initialValues` or `rates`.
+		@param count the number of elements of `initialValues`, `rates`, `numPeriods` and `dest`
+		@exception std::domain_error if an element of `rates` is `-1` or less. The content of `dest` is unspecified in this case.
+		@see compoundedValue(T, T, size_t)
+	*/
+	void compoundedValue(double const* initialValues, double const* rates, size_t const* numPeriods, double* dest, size_t count);
+}
+
+}
@@ -0,0 +1,329 @@
+#pragma once
+
+/** @file
+	Moving aggregates over the latest values of time series.
+
+	See Math::RollingStatistics, Math::RollingExtrema and Math::ExponentialMovingAverage classes documentation for details.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/**
+	Sum, simple moving average and variance of the latest values of a series.
+	Values are kept in a ring buffer allocated at construction time. Each push updates the aggregates in constant time: the value that leaves
+	the window is subtracted from them as the new one is added. The sum is compensated, and the aggregates are recomputed from the buffer
+	once per window so that rounding errors cannot accumulate. This costs a constant amortized time.
+
+	Until the window is full, the aggregates cover all the values pushed so far.
+
+	<b>Typical example of use</b>
+	@code
+	Math::RollingStatistics lastHour(60);
+
+	for (const auto& sample : samplesPerMinute)
+	{
+		lastHour.push(sample);
+		std::cout << lastHour.mean() << " +/- " << lastHour.standardDeviation() << std::endl;
+	}
+	@endcode
+
+	@see RollingExtrema
+*/
+class RollingStatistics
+{
+public:
+	/**
+		Constructor.
+		@param windowSize the number of latest values the aggregates cover
+		@exception std::invalid_argument if `windowSize` is zero
+	*/
+	explicit RollingStatistics(size_t windowSize);
+
+	/**
+		Empties the window.
+	*/
+	void reset();
+
+	/**
+		Adds a value. When the window is full, the oldest value leaves it.
+		@param value the value to add
+	*/
+	void push(double value);
+
+	/**
+		Adds values, in order.
+		@param values the values to add
+		@param count the number of elements of `values`
+	*/
+	void push(double const* values, size_t count);
+
+	/**
+		Returns the size of the window.
+		@return the number of latest values the aggregates cover when the window is full
+	*/
+	size_t windowSize() const;
+
+	/**
+		Returns the number of values in the window.
+		@return the number of values the aggregates currently cover, which is at most `windowSize()`
+	*/
+	size_t count() const;
+
+	/**
+		Tells whether the window is full.
+		@return `true` if `windowSize()` values have been pushed at least
+	*/
+	bool full() const;
+
+	/**
+		Returns the sum of the values in the window.
+		@return the sum, which is zero if the window is empty
+	*/
+	double sum() const;
+
+	/**
+		Returns the simple moving average.
+		@return the arithmetic mean of the values in the window
+		@exception std::domain_error if the window is empty
+	*/
+	double mean() const;
+
+	/**
+		Returns the population variance of the values in the window.
+		@return the population variance
+		@exception std::domain_error if the window is empty
+	*/
+	double variance() const;
+
+	/**
+		Returns the sample variance of the values in the window.
+		@return the sample variance
+		@exception std::domain_error if the window contains less than two values
+	*/
+	double sampleVariance() const;
+
+	/**
+		Returns the population standard deviation of the values in the window.
+		@return the square root of `variance()`
+		@exception std::domain_error if the window is empty
+	*/
+	double standardDeviation() const;
+
+private:
+	/// @cond INTERNAL
+
+	void checkNotEmpty(const char* caller) const;
+	void resynchronize();
+
+	std::vector<double> mValues; // ring buffer
+	size_t mNext;
+	size_t mCount;
+	size_t mUpdatesSinceResync;
+	double mSum;
+	double mCompensation;
+	double mM2; // sum of squares of differences from the mean
+
+	/// @endcond
+};
+
+
+/**
+	Minimum and maximum of the latest values of a series.
+	Values are kept in a ring buffer allocated at construction time, along with two monotonic queues of the candidates to be the minimum and
+	the maximum. Each push costs a constant amortized time and reading the extrema costs a constant time.
+
+	Until the window is full, the extrema cover all the values pushed so far.
+
+	<b>Typical example of use</b>
+	@code
+	Math::RollingExtrema lastDay(24);
+
+	for (const auto& price : hourlyPrices)
+	{
+		lastDay.push(price);
+		std::cout << lastDay.min() << " - " << lastDay.max() << std::endl;
+	}
+	@endcode
+
+	@see RollingStatistics
+*/
+class RollingExtrema
+{
+public:
+	/**
+		Constructor.
+		@param windowSize the number of latest values the extrema cover
+		@exception std::invalid_argument if `windowSize` is zero
+	*/
+	explicit RollingExtrema(size_t windowSize);
+
+	/**
+		Empties the window.
+	*/
+	void reset();
+
+	/**
+		Adds a value. When the window is full, the oldest value leaves it.
+		@param value the value to add
+		@exception std::invalid_argument if `value` is NaN
+	*/
+	void push(double value);
+
+	/**
+		Adds values, in order.
+		@param values the values to add
+		@param count the number of elements of `values`
+		@exception std::invalid_argument if one of the values is NaN. Values preceding it are added.
+	*/
+	void push(double const* values, size_t count);
+
+	/**
+		Returns the size of the window.
+		@return the number of latest values the extrema cover when the window is full
+	*/
+	size_t windowSize() const;
+
+	/**
+		Returns the number of values in the window.
+		@return the number of values the extrema currently cover, which is at most `windowSize()`
+	*/
+	size_t count() const;
+
+	/**
+		Tells whether the window is full.
+		@return `true` if `windowSize()` values have been pushed at least
+	*/
+	bool full() const;
+
+	/**
+		Returns the lowest value in the window.
+		@return the minimum
+		@exception std::domain_error if the window is empty
+	*/
+	double min() const;
+
+	/**
+		Returns the greatest value in the window.
+		@return the maximum
+		@exception std::domain_error if the window is empty
+	*/
+	double max() const;
+
+private:
+	/// @cond INTERNAL
+
+	// Positions of values in push order, whose values are monotonic. Stored in a ring buffer, as the window.
+	struct MonotonicQueue
+	{
+		std::vector<uint64_t> positions;
+		size_t front;
+		size_t size;
+	};
+
+	template<typename BEFORE> void update(MonotonicQueue& queue, double value, BEFORE before);
+	void checkNotEmpty(const char* caller) const;
+
+	std::vector<double> mValues; // ring buffer, indexed by push position modulo the window size
+	uint64_t mPushed;
+	MonotonicQueue mMinQueue;
+	MonotonicQueue mMaxQueue;
+
+	/// @endcond
+};
+
+
+/**
+	Exponential moving average of a series.
+	Each value is given a weight \f$\alpha\f$ and the previous average a weight \f$1 - \alpha\f$: \f$EMA_n = EMA_{n-1} + \alpha(x_n - EMA_{n-1})\f$.
+	The first value initializes the average. This class uses no buffer: each push costs a constant time.
+
+	<b>Typical example of use</b>
+	@code
+	auto ema(Math::ExponentialMovingAverage::fromSpan(20)); // alpha = 2 / 21
+
+	for (const auto& price : closingPrices)
+	{
+		ema.push(price);
+	}
+
+	std::cout << ema.value() << std::endl;
+	@endcode
+*/
+class ExponentialMovingAverage
+{
+public:
+	/**
+		Constructor.
+		@param alpha the smoothing factor, which is the weight of the latest value
+		@exception std::invalid_argument if `alpha` is not within \f$]0, 1]\f$
+	*/
+	explicit ExponentialMovingAverage(double alpha);
+
+	/**
+		Creates an exponential moving average whose smoothing factor is \f$\frac{2}{span + 1}\f$.
+		This is the usual convention of financial analysis, where the average is described by its number of periods.
+		@param span the number of periods
+		@return the exponential moving average
+		@exception std::invalid_argument if `span` is zero
+	*/
+	static ExponentialMovingAverage fromSpan(size_t span);
+
+	/**
+		Forgets all the values.
+	*/
+	void reset();
+
+	/**
+		Adds a value.
+		@param value the value to add
+	*/
+	void push(double value);
+
+	/**
+		Adds values, in order.
+		@param values the values to add
+		@param count the number of elements of `values`
+	*/
+	void push(double const* values, size_t count);
+
+	/**
+		Returns the smoothing factor.
+		@return the weight of the latest value
+	*/
+	double alpha() const;
+
+	/**
+		Returns the number of values.
+		@return the number of values pushed so far
+	*/
+	size_t count() const;
+
+	/**
+		Returns the exponential moving average.
+		@return the average
+		@exception std::domain_error if no value has been pushed
+	*/
+	double value() const;
+
+private:
+	/// @cond INTERNAL
+
+	double mAlpha;
+	size_t mCount;
+	double mValue;
+
+	/// @endcond
+};
+
+}
+
+}
@@ -0,0 +1,180 @@
+#pragma once
+
+/** @file
+	Single-pass descriptive statistics accumulator.
+
+	See Math::Statistics class documentation for details.
+*/
+
+#include <cstddef>
+#include <vector>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/**
+	Descriptive statistics computed in a single pass.
+	Values are pushed one by one or by arrays. Count, mean, variance, minimum, maximum, skewness and kurtosis are updated as they come,
+	without storing the values, using Welford's numerically stable updates generalized to the third and fourth central moments.
+
+	Accumulators can be merged. This allows computing partial statistics on several threads or nodes, then combining them. Merging gives
+	the same result as pushing all the values into a single accumulator, rounding errors aside.
+
+	Pushing arrays is faster than pushing the values one by one: arrays are processed by blocks whose moments are computed with independent
+	accumulators before being merged.
+
+	Instances are not thread-safe. Each thread should use its own instance.
+
+	<b>Typical example of use</b>
+	@code
+	std::vector<Math::Statistics> partials(nbThreads);
+
+	// ... each thread i calls partials[i].push(itsValues) ...
+
+	Math::Statistics overall;
+
+	for (const auto& partial : partials)
+	{
+		overall.merge(partial);
+	}
+
+	std::cout << overall.mean() << " +/- " << overall.standardDeviation() << std::endl;
+	@endcode
+*/
+class Statistics
+{
+public:
+	/**
+		Constructor.
+		The accumulator is empty.
+	*/
+	Statistics();
+
+	/**
+		Empties the accumulator.
+	*/
+	void reset();
+
+	/**
+		Adds a value.
+		@param value the value to add
+	*/
+	void push(double value);
+
+	/**
+		Adds values.
+		@param values the values to add
+		@param count the number of elements of `values`
+	*/
+	void push(double const* values, size_t count);
+
+	/**
+		Adds values.
+		@param values the values to add
+	*/
+	void push(std::vector<double> const& values);
+
+	/**
+		Adds the values of another accumulator to this one.
+		@param other the accumulator to merge into this one. It can be this accumulator.
+	*/
+	void merge(Statistics const& other);
+
+	/**
+		Returns the number of values.
+		@return the number of values pushed so far
+	*/
+	size_t count() const;
+
+	/**
+		Returns the arithmetic mean of the values.
+		@return the mean
+		@exception std::domain_error if the accumulator is empty
+	*/
+	double mean() const;
+
+	/**
+		Returns the population variance of the values.
+		This is \f$\frac{1}{n}\sum(x_i - \bar{x})^2\f$.
+		@return the population variance
+		@exception std::domain_error if the accumulator is empty
+	*/
+	double variance() const;
+
+	/**
+		Returns the sample variance of the values.
+		This is \f$\frac{1}{n - 1}\sum(x_i - \bar{x})^2\f$.
+		@return the sample variance
+		@exception std::domain_error if less than two values have been pushed
+	*/
+	double sampleVariance() const;
+
+	/**
+		Returns the population standard deviation of the values.
+		@return the square root of `variance()`
+		@exception std::domain_error if the accumulator is empty
+	*/
+	double standardDeviation() const;
+
+	/**
+		Returns the lowest value.
+		@return the minimum
+		@exception std::domain_error if the accumulator is empty
+	*/
+	double min() const;
+
+	/**
+		Returns the greatest value.
+		@return the maximum
+		@exception std::domain_error if the accumulator is empty
+	*/
+	double max() const;
+
+	/**
+		Returns the population skewness of the values.
+		This is \f$\frac{m_3}{m_2^{3/2}}\f$, where \f$m_k\f$ is the \f$k\f$th central moment.
+		@return the skewness
+		@exception std::domain_error if the accumulator is empty or if all values are equal
+	*/
+	double skewness() const;
+
+	/**
+		Returns the population kurtosis of the values.
+		This is \f$\frac{m_4}{m_2^2}\f$, where \f$m_k\f$ is the \f$k\f$th central moment. It is 3 for a normal distribution.
+		@return the kurtosis
+		@exception std::domain_error if the accumulator is empty or if all values are equal
+		@see excessKurtosis()
+	*/
+	double kurtosis() const;
+
+	/**
+		Returns the population excess kurtosis of the values.
+		@return `kurtosis() - 3`
+		@exception std::domain_error if the accumulator is empty or if all values are equal
+	*/
+	double excessKurtosis() const;
+
+private:
+	/// @cond INTERNAL
+
+	void checkNotEmpty(const char* caller) const;
+	void checkNotConstant(const char* caller) const;
+
+	size_t mCount;
+	double mMean;
+	double mM2; // sums of powers of differences from the mean
+	double mM3;
+	double mM4;
+	double mMin;
+	double mMax;
+
+	/// @endcond
+};
+
+}
+
+}
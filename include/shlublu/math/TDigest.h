@@ -0,0 +1,183 @@
+#pragma once
+
+/** @file
+	Mergeable streaming quantile sketch.
+
+	See Math::TDigest class documentation for details.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/**
+	Quantiles estimation over unbounded streams in constant memory, based on the merging t-digest of T. Dunning and O. Ertl (2019).
+
+	Values are summarized by at most `compression` weighted centroids. Centroids are smaller near both ends of the distribution, which keeps
+	extreme quantiles such as p99 or p999 accurate: with the default compression, the rank error is typically in the order of \f$10^{-4}\f$
+	at p999 and of \f$10^{-3}\f$ at p50, whatever the number of values.
+
+	Digests can be merged, including after being serialized and sent from another node. Merging gives a digest of the union of the values.
+
+	Instances are not thread-safe. Each thread should use its own instance.
+
+	<b>Typical example of use</b>
+	@code
+	Math::TDigest latencies;
+
+	for (const auto& request : requests)
+	{
+		latencies.push(request.durationMs());
+	}
+
+	const auto bytes(latencies.serialize()); // ... sent to an aggregation node ...
+
+	Math::TDigest overall;
+	overall.merge(Math::TDigest::deserialize(bytes));
+
+	std::cout << overall.quantile(0.5) << " " << overall.quantile(0.99) << " " << overall.quantile(0.999) << std::endl;
+	@endcode
+*/
+class TDigest
+{
+public:
+	static constexpr double defaultCompression = 200.0; /**< Compression used by default. */
+	static constexpr double minCompression = 10.0; /**< Lowest compression accepted. */
+	static constexpr double maxCompression = 100000.0; /**< Greatest compression accepted. Buffers are allocated according to the compression. */
+
+public:
+	/**
+		Constructor.
+		@param compression the accuracy/size trade-off. Greater values give more accurate quantiles with more centroids.
+		@exception std::invalid_argument if `compression` is not within [`minCompression`, `maxCompression`]
+	*/
+	TDigest(double compression = defaultCompression);
+
+	/**
+		Returns the compression of this digest.
+		@return the compression given at construction time
+	*/
+	double compression() const;
+
+	/**
+		Adds a value.
+		@param value the value to add
+		@exception std::invalid_argument if `value` is NaN
+	*/
+	void push(double value);
+
+	/**
+		Adds values.
+		@param values the values to add
+		@param count the number of elements of `values`
+		@exception std::invalid_argument if one of the values is NaN. Values preceding it are added.
+	*/
+	void push(double const* values, size_t count);
+
+	/**
+		Adds values.
+		@param values the values to add
+		@exception std::invalid_argument if one of the values is NaN. Values preceding it are added.
+	*/
+	void push(std::vector<double> const& values);
+
+	/**
+		Adds the values summarized by another digest to this one.
+		The compression of this digest is kept.
+		@param other the digest to merge into this one. It can be this digest.
+	*/
+	void merge(TDigest const& other);
+
+	/**
+		Returns the number of values.
+		@return the number of values pushed into this digest or into the digests merged into it
+	*/
+	uint64_t count() const;
+
+	/**
+		Returns the lowest value.
+		@return the minimum
+		@exception std::domain_error if the digest is empty
+	*/
+	double min() const;
+
+	/**
+		Returns the greatest value.
+		@return the maximum
+		@exception std::domain_error if the digest is empty
+	*/
+	double max() const;
+
+	/**
+		Estimates a quantile.
+		@param q the quantile to estimate, for example `0.99` for p99
+		@return the estimated value below which a proportion `q` of the values lies
+		@exception std::invalid_argument if `q` is not within \f$[0, 1]\f$
+		@exception std::domain_error if the digest is empty
+	*/
+	double quantile(double q) const;
+
+	/**
+		Estimates the cumulative distribution function.
+		@param x the value to evaluate the function at
+		@return the estimated proportion of values lower than or equal to `x`
+		@exception std::domain_error if the digest is empty
+	*/
+	double cdf(double x) const;
+
+	/**
+		Returns the number of centroids.
+		This is the size of the summary, which does not depend on `count()`.
+		@return the number of centroids
+	*/
+	size_t centroidsCount() const;
+
+	/**
+		Serializes this digest.
+		The format is portable: it does not depend on the endianness or the word size of the platform.
+		@return the serialized digest
+		@see deserialize()
+	*/
+	std::vector<uint8_t> serialize() const;
+
+	/**
+		Deserializes a digest.
+		@param bytes data returned by `serialize()`
+		@return the deserialized digest
+		@exception std::invalid_argument if `bytes` is not a valid serialized digest
+	*/
+	static TDigest deserialize(std::vector<uint8_t> const& bytes);
+
+private:
+	/// @cond INTERNAL
+
+	struct Centroid
+	{
+		double mean;
+		double weight;
+	};
+
+	void compress() const;
+
+	double mCompression;
+	uint64_t mCount;
+	double mMin;
+	double mMax;
+
+	// Queries merge the buffer into the centroids, which does not change the summarized values
+	mutable std::vector<Centroid> mCentroids;
+	mutable std::vector<Centroid> mBuffer;
+
+	/// @endcond
+};
+
+}
+
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+/** @file
+	Low-discrepancy (quasi-random) sequences generators: Sobol, Halton and R2.
+
+	See QuasiRandomSequence class documentation for details.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace shlublu
+{
+
+/**
+	Base class of low-discrepancy sequences generators.
+
+	Low-discrepancy sequences fill the unit hypercube \f$[0, 1)^{dimensions}\f$ much more evenly than pseudo-random numbers do.
+	Used for Monte Carlo integration, they reach a given error with far fewer points than `Random::randomUnit<double>()` would.
+
+	Points are indexed from 0. `next()` computes the point whose index is `index()` and moves the cursor forward. Any index can be reached
+	directly with `seek()` (skip-ahead), and `generate()` computes many consecutive points at once in a row-major buffer.
+
+	Some generators can be scrambled at construction time. Scrambling parameters are drawn from the `Random` engine, so that two scrambled
+	instances give distinct sequences while keeping the low-discrepancy property.
+
+	<b>Typical example of use</b>
+	@code
+	SobolSequence sobol(2);
+	double inside(0);
+
+	for (size_t i = 0; i < 4096; ++i)
+	{
+		sobol.next();
+
+		const auto& p(sobol.point());
+		inside += (p[0] * p[0] + p[1] * p[1] < 1.0) ? 1.0 : 0.0;
+	}
+
+	std::cout << 4.0 * inside / 4096.0 << std::endl; // 3.14...
+	@endcode
+*/
+class QuasiRandomSequence
+{
+public:
+	/**
+		Constructor.
+		@param dimensions number of dimensions of the points
+		@exception std::invalid_argument if `dimensions` is zero
+	*/
+	QuasiRandomSequence(size_t dimensions);
+
+	/**
+		Destructor.
+	*/
+	virtual ~QuasiRandomSequence();
+
+	/**
+		Returns the number of dimensions of the points.
+		@return the number of dimensions
+	*/
+	size_t dimensions() const;
+
+	/**
+		Returns the index of the point the next call to `next()` will compute.
+		@return the index of the next point
+	*/
+	size_t index() const;
+
+	/**
+		Returns the maximal number of points this sequence can produce.
+		@return the number of points of the sequence
+	*/
+	virtual size_t size() const = 0;
+
+	/**
+		Returns the point computed by the last call to `next()`.
+		Its size is `dimensions()`. It is empty as long as `next()` has not been called.
+		@return the current point
+	*/
+	std::vector<double> const& point() const;
+
+	/**
+		Computes the point whose index is `index()` and moves forward.
+		@return `true` if a point has been computed, `false` if the sequence is exhausted
+	*/
+	bool next();
+
+	/**
+		Sets the index of the point the next call to `next()` will compute.
+		This is done without computing the intermediate points.
+		@param index the index of the next point
+		@exception std::out_of_range if `index` is greater than `size()`
+	*/
+	void seek(size_t index);
+
+	/**
+		Skips a given number of points.
+		@param count the number of points to skip
+		@exception std::out_of_range if this would go beyond `size()`
+	*/
+	void skip(size_t count);
+
+	/**
+		Computes a batch of consecutive points, starting at `index()`, and moves forward.
+		Points are stored row-major: the coordinate `d` of the `i`th point is `dest[i * dimensions() + d]`. `point()` is left unchanged.
+		@param dest the buffer to write to. It should be able to store `count * dimensions()` values.
+		@param count the number of points to compute
+		@return the number of points actually computed, which is lower than `count` if the sequence is exhausted
+	*/
+	size_t generate(double* dest, size_t count);
+
+	/**
+		Computes a batch of consecutive points, starting at `index()`, and moves forward.
+		@param count the number of points to compute
+		@return a row-major vector of the computed points
+		@see generate(double*, size_t)
+	*/
+	std::vector<double> generate(size_t count);
+
+protected:
+	/// @cond INTERNAL
+
+	virtual void computePoint(size_t index, double* dest) const = 0;
+	virtual void computeNextPoints(double* dest, size_t count);
+	virtual void seekState(size_t index);
+
+	const size_t mDimensions;
+	size_t mIndex;
+
+	/// @endcond
+
+private:
+	/// @cond INTERNAL
+
+	std::vector<double> mPoint;
+
+	/// @endcond
+};
+
+
+/**
+	Sobol sequence.
+	Direction numbers are those of S. Joe and F. Y. Kuo (2008), which support up to `SobolSequence::maxDimensions` dimensions.
+	Points have a 32-bit resolution and the sequence has \f$2^{32}\f$ points.
+
+	Owen nested uniform scrambling can be applied. This randomizes the sequence while preserving its distribution properties,
+	which allows estimating the integration error by using several scrambled instances.
+*/
+class SobolSequence : public QuasiRandomSequence
+{
+public:
+	static constexpr size_t maxDimensions = 21; /**< Maximal number of dimensions supported. */
+
+public:
+	/**
+		Constructor.
+		@param dimensions number of dimensions of the points
+		@param scrambled whether Owen scrambling should be applied, seeded from the `Random` engine
+		@exception std::invalid_argument if `dimensions` is zero or greater than `maxDimensions`
+	*/
+	SobolSequence(size_t dimensions, bool scrambled = false);
+
+	/**
+		Destructor.
+	*/
+	virtual ~SobolSequence();
+
+	virtual size_t size() const;
+
+protected:
+	/// @cond INTERNAL
+
+	virtual void computePoint(size_t index, double* dest) const;
+	virtual void computeNextPoints(double* dest, size_t count);
+	virtual void seekState(size_t index);
+
+	/// @endcond
+
+private:
+	/// @cond INTERNAL
+
+	double toUnit(size_t dimension, uint32_t value) const;
+
+	std::vector<uint32_t> mDirections; // [bit][dimension]
+	std::vector<uint32_t> mState;
+	std::vector<uint64_t> mSeeds; // empty if not scrambled
+
+	/// @endcond
+};
+
+
+/**
+	Halton sequence.
+	Dimension `d` is the radical inverse of the index in the `d`th prime base. Any number of dimensions is supported, though the
+	quality of the projections decreases as the bases grow: a Sobol sequence is preferable beyond a few tens of dimensions.
+
+	Scrambling applies a random permutation to the digits of each dimension.
+*/
+class HaltonSequence : public QuasiRandomSequence
+{
+public:
+	/**
+		Constructor.
+		@param dimensions number of dimensions of the points
+		@param scrambled whether random digit permutations should be applied, drawn from the `Random` engine
+		@exception std::invalid_argument if `dimensions` is zero
+	*/
+	HaltonSequence(size_t dimensions, bool scrambled = false);
+
+	/**
+		Destructor.
+	*/
+	virtual ~HaltonSequence();
+
+	virtual size_t size() const;
+
+protected:
+	/// @cond INTERNAL
+
+	virtual void computePoint(size_t index, double* dest) const;
+
+	/// @endcond
+
+private:
+	/// @cond INTERNAL
+
+	std::vector<uint32_t> mBases;
+	std::vector<std::vector<uint32_t>> mPermutations; // empty if not scrambled
+
+	/// @endcond
+};
+
+
+/**
+	R2 sequence, as described by M. Roberts (2018).
+	Dimension `d` of the point of index `i` is \f$frac(s_d + i \alpha_d)\f$, where \f$\alpha_d = \phi^{-(d + 1)}\f$ and \f$\phi\f$ is the
+	unique positive root of \f$x^{dimensions + 1} = x + 1\f$. This additive recurrence is computed in 64-bit fixed point, so that it is
+	exact whatever the index.
+
+	Any number of dimensions is supported. Scrambling replaces the usual \f$s_d = 0.5\f$ offsets by random ones (Cranley-Patterson rotation).
+*/
+class R2Sequence : public QuasiRandomSequence
+{
+public:
+	/**
+		Constructor.
+		@param dimensions number of dimensions of the points
+		@param scrambled whether random offsets should be used, drawn from the `Random` engine
+		@exception std::invalid_argument if `dimensions` is zero
+	*/
+	R2Sequence(size_t dimensions, bool scrambled = false);
+
+	/**
+		Destructor.
+	*/
+	virtual ~R2Sequence();
+
+	virtual size_t size() const;
+
+protected:
+	/// @cond INTERNAL
+
+	virtual void computePoint(size_t index, double* dest) const;
+	virtual void computeNextPoints(double* dest, size_t count);
+	virtual void seekState(size_t index);
+
+	/// @endcond
+
+private:
+	/// @cond INTERNAL
+
+	std::vector<uint64_t> mAlphas;
+	std::vector<uint64_t> mOffsets;
+	std::vector<uint64_t> mState;
+
+	/// @endcond
+};
+
+}
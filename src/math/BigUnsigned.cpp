@@ -0,0 +1,560 @@
+#include <shlublu/math/BigUnsigned.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace shlublu
+{
+
+/// @cond INTERNAL
+
+namespace
+{
+	using Limbs = std::vector<uint32_t>;
+
+	constexpr size_t __karatsubaThreshold = 32;
+	constexpr uint32_t __decimalChunk = 1000000000; // 10^9, the largest power of 10 that fits a limb
+	constexpr size_t __decimalChunkDigits = 9;
+
+
+	size_t __significantSize(uint32_t const* x, size_t size)
+	{
+		while (size && !x[size - 1])
+		{
+			--size;
+		}
+
+		return size;
+	}
+
+
+	void __trim(Limbs& x)
+	{
+		x.resize(__significantSize(x.data(), x.size()));
+	}
+
+
+	// dest += src * 2^(32 * shift)
+	void __addShifted(Limbs& dest, uint32_t const* src, size_t srcSize, size_t shift)
+	{
+		if (dest.size() < srcSize + shift)
+		{
+			dest.resize(srcSize + shift, 0);
+		}
+
+		uint64_t carry(0);
+
+		for (size_t i = 0; i < srcSize; ++i)
+		{
+			carry += uint64_t(dest[i + shift]) + src[i];
+			dest[i + shift] = static_cast<uint32_t>(carry);
+			carry >>= 32;
+		}
+
+		for (size_t i = srcSize + shift; carry; ++i)
+		{
+			if (i == dest.size())
+			{
+				dest.push_back(0);
+			}
+
+			carry += dest[i];
+			dest[i] = static_cast<uint32_t>(carry);
+			carry >>= 32;
+		}
+	}
+
+
+	// dest -= src, dest being known to be greater than or equal to src
+	void __subtract(Limbs& dest, Limbs const& src)
+	{
+		int64_t borrow(0);
+
+		for (size_t i = 0; i < dest.size() && (i < src.size() || borrow); ++i)
+		{
+			const int64_t diff(int64_t(dest[i]) - (i < src.size() ? src[i] : 0) - borrow);
+
+			borrow = diff < 0 ? 1 : 0;
+			dest[i] = static_cast<uint32_t>(diff + (borrow << 32));
+		}
+
+		__trim(dest);
+	}
+
+
+	Limbs __multiplySchoolbook(uint32_t const* a, size_t aSize, uint32_t const* b, size_t bSize)
+	{
+		Limbs ret(aSize + bSize, 0);
+
+		for (size_t i = 0; i < aSize; ++i)
+		{
+			if (a[i])
+			{
+				uint64_t carry(0);
+
+				for (size_t j = 0; j < bSize; ++j)
+				{
+					carry += uint64_t(a[i]) * b[j] + ret[i + j];
+					ret[i + j] = static_cast<uint32_t>(carry);
+					carry >>= 32;
+				}
+
+				ret[i + bSize] = static_cast<uint32_t>(carry);
+			}
+		}
+
+		__trim(ret);
+
+		return ret;
+	}
+
+
+	Limbs __multiply(uint32_t const* a, size_t aSize, uint32_t const* b, size_t bSize)
+	{
+		aSize = __significantSize(a, aSize);
+		bSize = __significantSize(b, bSize);
+
+		if (aSize < bSize)
+		{
+			std::swap(a, b);
+			std::swap(aSize, bSize);
+		}
+
+		if (bSize < __karatsubaThreshold)
+		{
+			return __multiplySchoolbook(a, aSize, b, bSize);
+		}
+
+		const size_t half(aSize / 2);
+
+		if (bSize <= half)
+		{
+			// Unbalanced operands: only a is split
+			Limbs ret(__multiply(a, half, b, bSize));
+			const Limbs high(__multiply(a + half, aSize - half, b, bSize));
+
+			__addShifted(ret, high.data(), high.size(), half);
+
+			return ret;
+		}
+
+		// Karatsuba: a * b = z2 * B^2h + z1 * B^h + z0, with z1 = (a0 + a1)(b0 + b1) - z2 - z0
+		const Limbs z0(__multiply(a, half, b, half));
+		const Limbs z2(__multiply(a + half, aSize - half, b + half, bSize - half));
+
+		Limbs aSum(a, a + half);
+		__addShifted(aSum, a + half, aSize - half, 0);
+
+		Limbs bSum(b, b + half);
+		__addShifted(bSum, b + half, bSize - half, 0);
+
+		Limbs z1(__multiply(aSum.data(), aSum.size(), bSum.data(), bSum.size()));
+		__subtract(z1, z0);
+		__subtract(z1, z2);
+
+		Limbs ret(z0);
+		__addShifted(ret, z1.data(), z1.size(), half);
+		__addShifted(ret, z2.data(), z2.size(), 2 * half);
+		__trim(ret);
+
+		return ret;
+	}
+
+
+	BigUnsigned __product(size_t from, size_t to)
+	{
+		// Product of [from, to) by binary splitting, so that operands remain balanced
+		BigUnsigned ret(1);
+
+		if (to - from <= 8)
+		{
+			for (size_t i = from; i < to; ++i)
+			{
+				ret *= BigUnsigned(i);
+			}
+		}
+		else
+		{
+			const size_t middle(from + (to - from) / 2);
+			ret = __product(from, middle) * __product(middle, to);
+		}
+
+		return ret;
+	}
+}
+
+/// @endcond
+
+
+BigUnsigned::BigUnsigned(uint64_t value)
+	: mSmall{ static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32), 0, 0 },
+	  mLarge(),
+	  mSize(2)
+{
+	trim();
+}
+
+
+BigUnsigned::BigUnsigned(std::string const& decimal)
+	: BigUnsigned()
+{
+	if (decimal.empty() || decimal.find_first_not_of("0123456789") != std::string::npos)
+	{
+		throw std::invalid_argument("BigUnsigned::BigUnsigned(): '" + decimal + "' is not a decimal number.");
+	}
+
+	for (size_t pos = 0, digits = (decimal.size() - 1) % __decimalChunkDigits + 1; pos < decimal.size(); pos += digits, digits = __decimalChunkDigits)
+	{
+		multiplyBy(__decimalChunk);
+		*this += BigUnsigned(std::stoul(decimal.substr(pos, digits)));
+	}
+}
+
+
+BigUnsigned::BigUnsigned(BigUnsigned&& other) noexcept
+	: mSmall{ other.mSmall[0], other.mSmall[1], other.mSmall[2], other.mSmall[3] },
+	  mLarge(std::move(other.mLarge)),
+	  mSize(other.mSize)
+{
+	other.mLarge.clear();
+	other.mSize = 0;
+}
+
+
+BigUnsigned& BigUnsigned::operator=(BigUnsigned&& other) noexcept
+{
+	if (this != &other)
+	{
+		std::copy(other.mSmall, other.mSmall + smallSize, mSmall);
+		mLarge = std::move(other.mLarge);
+		mSize = other.mSize;
+
+		other.mLarge.clear();
+		other.mSize = 0;
+	}
+
+	return *this;
+}
+
+
+bool BigUnsigned::isZero() const
+{
+	return !mSize;
+}
+
+
+size_t BigUnsigned::bits() const
+{
+	size_t ret(0);
+
+	if (mSize)
+	{
+		ret = 32 * (mSize - 1);
+
+		for (uint32_t top = data()[mSize - 1]; top; top >>= 1)
+		{
+			++ret;
+		}
+	}
+
+	return ret;
+}
+
+
+bool BigUnsigned::fitsUint64() const
+{
+	return mSize <= 2;
+}
+
+
+uint64_t BigUnsigned::toUint64() const
+{
+	if (!fitsUint64())
+	{
+		throw std::overflow_error("BigUnsigned::toUint64(): " + toString() + " cannot be represented by uint64_t.");
+	}
+
+	return (mSize > 1 ? uint64_t(data()[1]) << 32 : 0) | (mSize > 0 ? data()[0] : 0);
+}
+
+
+std::string BigUnsigned::toString() const
+{
+	std::vector<uint32_t> chunks;
+	BigUnsigned quotient(*this);
+
+	do
+	{
+		chunks.push_back(quotient.divideBy(__decimalChunk));
+	}
+	while (!quotient.isZero());
+
+	std::string ret(std::to_string(chunks.back()));
+
+	for (auto chunk = chunks.rbegin() + 1; chunk != chunks.rend(); ++chunk)
+	{
+		const std::string digits(std::to_string(*chunk));
+		ret.append(__decimalChunkDigits - digits.size(), '0').append(digits);
+	}
+
+	return ret;
+}
+
+
+int BigUnsigned::compare(BigUnsigned const& other) const
+{
+	int ret(mSize < other.mSize ? -1 : (mSize > other.mSize ? 1 : 0));
+
+	for (size_t i = mSize; !ret && i-- > 0; )
+	{
+		ret = data()[i] < other.data()[i] ? -1 : (data()[i] > other.data()[i] ? 1 : 0);
+	}
+
+	return ret;
+}
+
+
+BigUnsigned& BigUnsigned::operator+=(BigUnsigned const& other)
+{
+	if (this == &other)
+	{
+		multiplyBy(2);
+	}
+	else
+	{
+		const size_t size(std::max(mSize, other.mSize) + 1);
+		uint64_t carry(0);
+
+		resize(size);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			carry += uint64_t(data()[i]) + (i < other.mSize ? other.data()[i] : 0);
+			data()[i] = static_cast<uint32_t>(carry);
+			carry >>= 32;
+		}
+
+		trim();
+	}
+
+	return *this;
+}
+
+
+BigUnsigned& BigUnsigned::operator-=(BigUnsigned const& other)
+{
+	if (compare(other) < 0)
+	{
+		throw std::domain_error("BigUnsigned::operator-=(): " + other.toString() + " > " + toString());
+	}
+
+	int64_t borrow(0);
+
+	for (size_t i = 0; i < mSize && (i < other.mSize || borrow); ++i)
+	{
+		const int64_t diff(int64_t(data()[i]) - (i < other.mSize ? other.data()[i] : 0) - borrow);
+
+		borrow = diff < 0 ? 1 : 0;
+		data()[i] = static_cast<uint32_t>(diff + (borrow << 32));
+	}
+
+	trim();
+
+	return *this;
+}
+
+
+BigUnsigned& BigUnsigned::operator*=(BigUnsigned const& other)
+{
+	if (other.mSize <= 1)
+	{
+		multiplyBy(other.mSize ? other.data()[0] : 0);
+	}
+	else if (mSize <= 1)
+	{
+		const uint32_t factor(mSize ? data()[0] : 0);
+
+		*this = other;
+		multiplyBy(factor);
+	}
+	else
+	{
+		assign(__multiply(data(), mSize, other.data(), other.mSize));
+	}
+
+	return *this;
+}
+
+
+uint32_t BigUnsigned::divideBy(uint32_t divisor)
+{
+	if (!divisor)
+	{
+		throw std::domain_error("BigUnsigned::divideBy(): division by zero.");
+	}
+
+	uint64_t remainder(0);
+
+	for (size_t i = mSize; i-- > 0; )
+	{
+		remainder = (remainder << 32) | data()[i];
+		data()[i] = static_cast<uint32_t>(remainder / divisor);
+		remainder %= divisor;
+	}
+
+	trim();
+
+	return static_cast<uint32_t>(remainder);
+}
+
+
+uint32_t* BigUnsigned::data()
+{
+	return mLarge.empty() ? mSmall : mLarge.data();
+}
+
+
+uint32_t const* BigUnsigned::data() const
+{
+	return mLarge.empty() ? mSmall : mLarge.data();
+}
+
+
+void BigUnsigned::resize(size_t size)
+{
+	if (size > smallSize || !mLarge.empty())
+	{
+		if (mLarge.empty())
+		{
+			mLarge.assign(mSmall, mSmall + mSize);
+		}
+
+		mLarge.resize(size, 0);
+	}
+	else if (size > mSize)
+	{
+		std::fill(mSmall + mSize, mSmall + size, 0);
+	}
+
+	mSize = size;
+}
+
+
+void BigUnsigned::trim()
+{
+	resize(__significantSize(data(), mSize));
+}
+
+
+void BigUnsigned::assign(std::vector<uint32_t>&& limbs)
+{
+	if (limbs.size() > smallSize)
+	{
+		mLarge = std::move(limbs);
+		mSize = mLarge.size();
+	}
+	else
+	{
+		mLarge.clear();
+		std::copy(limbs.begin(), limbs.end(), mSmall);
+		mSize = limbs.size();
+	}
+}
+
+
+void BigUnsigned::multiplyBy(uint32_t factor)
+{
+	const size_t size(mSize);
+	uint64_t carry(0);
+
+	resize(size + 1);
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		carry += uint64_t(data()[i]) * factor;
+		data()[i] = static_cast<uint32_t>(carry);
+		carry >>= 32;
+	}
+
+	data()[size] = static_cast<uint32_t>(carry);
+
+	trim();
+}
+
+
+BigUnsigned operator+(BigUnsigned lhs, BigUnsigned const& rhs)
+{
+	return lhs += rhs;
+}
+
+
+BigUnsigned operator-(BigUnsigned lhs, BigUnsigned const& rhs)
+{
+	return lhs -= rhs;
+}
+
+
+BigUnsigned operator*(BigUnsigned lhs, BigUnsigned const& rhs)
+{
+	return lhs *= rhs;
+}
+
+
+std::ostream& operator<<(std::ostream& os, BigUnsigned const& value)
+{
+	return os << value.toString();
+}
+
+
+namespace Math
+{
+
+template<> BigUnsigned factorial(BigUnsigned n)
+{
+	if (n.bits() > std::numeric_limits<size_t>::digits)
+	{
+		throw std::domain_error("Math::factorial(): " + n.toString() + " is too large.");
+	}
+
+	const size_t value(static_cast<size_t>(n.toUint64()));
+
+	return __product(1, value + 1);
+}
+
+
+template<> BigUnsigned binomial(BigUnsigned n, BigUnsigned k)
+{
+	BigUnsigned ret(0);
+
+	if (k <= n)
+	{
+		if (n.bits() > std::numeric_limits<size_t>::digits)
+		{
+			throw std::domain_error("Math::binomial(): " + n.toString() + " is too large.");
+		}
+
+		const size_t nValue(static_cast<size_t>(n.toUint64()));
+		const size_t kValue(std::min(static_cast<size_t>(k.toUint64()), nValue - static_cast<size_t>(k.toUint64())));
+
+		if (kValue > std::numeric_limits<uint32_t>::max())
+		{
+			throw std::domain_error("Math::binomial(): " + k.toString() + " is too large.");
+		}
+
+		// Each intermediate result is binomial(nValue - kValue + i, i), hence the exact divisions
+		ret = BigUnsigned(1);
+
+		for (size_t i = 1; i <= kValue; ++i)
+		{
+			ret *= BigUnsigned(nValue - kValue + i);
+			ret.divideBy(static_cast<uint32_t>(i));
+		}
+	}
+
+	return ret;
+}
+
+}
+
+}
@@ -0,0 +1,79 @@
+#include <shlublu/math/Math.h>
+
+#include <vector>
+
+#include <shlublu/async/MutexLock.h>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/// @cond INTERNAL
+
+// Rows only store their first half, the second one being symmetrical. Only rows whose entries can all be represented by size_t are stored:
+// the triangle is complete once the next row would have entries that overflow.
+static std::vector<std::vector<size_t>> __pascalTriangle;
+static bool __pascalTriangleComplete(false);
+static MutexLock __pascalTriangleLock;
+
+/// @endcond
+
+
+size_t cachedBinomial(size_t n, size_t k)
+{
+	size_t ret(0);
+
+	if (k <= n)
+	{
+		k = std::min(k, n - k);
+
+		bool cached(false);
+
+		{
+			MutexLock::Guard guard(__pascalTriangleLock);
+
+			while (__pascalTriangle.size() <= n && !__pascalTriangleComplete)
+			{
+				const size_t row(__pascalTriangle.size());
+				std::vector<size_t> entries(row / 2 + 1, 1);
+
+				for (size_t i = 1; i < entries.size() && !__pascalTriangleComplete; ++i)
+				{
+					const auto& previous(__pascalTriangle.back());
+
+					const size_t left(previous[i - 1]);
+					const size_t right(previous[std::min(i, row - 1 - i)]);
+
+					__pascalTriangleComplete = (left > std::numeric_limits<size_t>::max() - right);
+					entries[i] = left + right;
+				}
+
+				if (!__pascalTriangleComplete)
+				{
+					__pascalTriangle.push_back(std::move(entries));
+				}
+			}
+
+			if (n < __pascalTriangle.size())
+			{
+				ret = __pascalTriangle[n][k];
+				cached = true;
+			}
+		}
+
+		// Some entries of greater rows can be represented, such as binomial(n, 1): binomial() computes them, or throws
+		if (!cached)
+		{
+			ret = binomial(n, k);
+		}
+	}
+
+	return ret;
+}
+
+}
+
+}
@@ -0,0 +1,1189 @@
+#include <shlublu/math/Math.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define __SHLUBLU_X86
+#endif
+
+#ifdef __SHLUBLU_X86
+#ifdef _WIN32
+#include <intrin.h>
+#define __SHLUBLU_AVX2
+#define __SHLUBLU_AVX2_FMA
+#else
+#include <immintrin.h>
+#define __SHLUBLU_AVX2 __attribute__((target("avx2")))
+#define __SHLUBLU_AVX2_FMA __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/// @cond INTERNAL
+
+/*
+	Scalar kernels.
+	They are used when AVX2 is not available, and to process the tails of the arrays otherwise.
+	Kernels that detect errors return the index of the first offending element, or `count` if there is none.
+*/
+
+template<typename T> static void __clampScalar(T const* values, T* dest, size_t count, T minVal, T maxVal)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		dest[i] = std::max<T>(minVal, std::min<T>(values[i], maxVal));
+	}
+}
+
+
+template<typename T> static void __roundXScalar(T* numbers, size_t count, T factor)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		numbers[i] = __roundHalfAwayFromZero(factor * numbers[i]) / factor;
+	}
+}
+
+
+template<typename T> static void __sameSignScalar(T const* x, T const* y, bool* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		dest[i] = (x[i] >= T(0)) ^ (y[i] < T(0));
+	}
+}
+
+
+template<typename T> static size_t __proportionalIncreaseScalar(T const* initialValues, T const* finalValues, T* dest, size_t count)
+{
+	size_t firstZero(count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (initialValues[i] == T(0) && firstZero == count)
+		{
+			firstZero = i;
+		}
+
+		dest[i] = (finalValues[i] / initialValues[i]) - T(1.0);
+	}
+
+	return firstZero;
+}
+
+
+// Growth kernels throw themselves: `firstIndex` is the index of their first element in the arrays given by the caller
+template<typename T> static void __increaseRateScalar(T const* overallIncreases, T* dest, size_t count, size_t numPeriods, size_t firstIndex)
+{
+	const T exponent(T(1.0) / T(numPeriods));
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (overallIncreases[i] <= T(-1.0))
+		{
+			throw std::domain_error("Math::increaseRate(): overallIncreases[" + String::xtos(firstIndex + i) + "] (" + String::xtos(overallIncreases[i]) + ") should be greater than -1.0 for the result to be real.");
+		}
+
+		dest[i] = std::pow<T>(T(1.0) + overallIncreases[i], exponent) - T(1.0);
+	}
+}
+
+
+static void __increaseRatesScalar(double const* initialValues, double const* finalValues, size_t const* numPeriods, double* dest, size_t count, size_t firstIndex)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		const std::string index(String::xtos(firstIndex + i));
+
+		if (initialValues[i] == 0.0)
+		{
+			throw std::invalid_argument("Math::increaseRate(): initialValues[" + index + "] should not be zero.");
+		}
+
+		if (numPeriods[i] == 0)
+		{
+			throw std::invalid_argument("Math::increaseRate(): numPeriods[" + index + "] should be strictly positive.");
+		}
+
+		const double ratio(finalValues[i] / initialValues[i]);
+
+		if (ratio <= 0.0)
+		{
+			throw std::domain_error("Math::increaseRate(): finalValues[" + index + "] / initialValues[" + index + "] (" + String::xtos(ratio) + ") should be greater than zero for the result to be real.");
+		}
+
+		// The rounding error of the quotient is compensated for: it would otherwise dominate rates close to zero
+		const double product(ratio * initialValues[i]);
+		const double correction(((finalValues[i] - product) - Math::__productError(ratio, initialValues[i], product)) / finalValues[i]);
+		const double logRatio(std::log(ratio));
+
+		dest[i] = std::expm1((std::isfinite(correction) ? logRatio + correction : logRatio) / static_cast<double>(numPeriods[i]));
+	}
+}
+
+
+static void __compoundedValueScalar(double const* initialValues, double const* rates, size_t const* numPeriods, double* dest, size_t count, size_t firstIndex)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (rates[i] <= -1.0)
+		{
+			throw std::domain_error("Math::compoundedValue(): rates[" + String::xtos(firstIndex + i) + "] (" + String::xtos(rates[i]) + ") should be greater than -1.0.");
+		}
+
+		dest[i] = initialValues[i] * std::pow(1.0 + rates[i], static_cast<double>(numPeriods[i]));
+	}
+}
+
+
+template<typename T> static void __fastExpScalar(T const* x, T* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		dest[i] = fastExp(x[i]);
+	}
+}
+
+
+template<typename T> static void __fastLogScalar(T const* x, T* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		dest[i] = fastLog(x[i]);
+	}
+}
+
+
+template<typename T> static void __fastPowScalar(T const* x, T const* y, T* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		dest[i] = fastPow(x[i], y[i]);
+	}
+}
+
+
+template<typename T> static void __fastSigmoidScalar(T const* x, T* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		dest[i] = fastSigmoid(x[i]);
+	}
+}
+
+
+#ifdef __SHLUBLU_X86
+
+/*
+	Minimal AVX2 wrapper.
+	min(a, b) and max(a, b) return `b` when the comparison is false, which matches std::min(b, a) and std::max(b, a), NaN included.
+	Comparison functions return a bit mask whose bit `k` is the result of the comparison of the `k`th elements.
+*/
+
+template<typename T> struct __Avx2;
+
+
+template<> struct __Avx2<double>
+{
+	typedef __m256d Vector;
+	static constexpr size_t width = 4;
+
+	__SHLUBLU_AVX2 static Vector load(double const* p) { return _mm256_loadu_pd(p); }
+	__SHLUBLU_AVX2 static void store(double* p, Vector v) { _mm256_storeu_pd(p, v); }
+	__SHLUBLU_AVX2 static Vector set1(double x) { return _mm256_set1_pd(x); }
+
+	__SHLUBLU_AVX2 static Vector min(Vector a, Vector b) { return _mm256_min_pd(a, b); }
+	__SHLUBLU_AVX2 static Vector max(Vector a, Vector b) { return _mm256_max_pd(a, b); }
+	__SHLUBLU_AVX2 static Vector add(Vector a, Vector b) { return _mm256_add_pd(a, b); }
+	__SHLUBLU_AVX2 static Vector sub(Vector a, Vector b) { return _mm256_sub_pd(a, b); }
+	__SHLUBLU_AVX2 static Vector mul(Vector a, Vector b) { return _mm256_mul_pd(a, b); }
+	__SHLUBLU_AVX2 static Vector div(Vector a, Vector b) { return _mm256_div_pd(a, b); }
+	__SHLUBLU_AVX2 static Vector truncate(Vector a) { return _mm256_round_pd(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+	__SHLUBLU_AVX2_FMA static Vector multiplySubtract(Vector a, Vector b, Vector c) { return _mm256_fmsub_pd(a, b, c); }
+	__SHLUBLU_AVX2 static Vector copySign(Vector magnitude, Vector sign) { return _mm256_or_pd(_mm256_andnot_pd(set1(-double(0)), magnitude), _mm256_and_pd(set1(-double(0)), sign)); }
+
+	__SHLUBLU_AVX2 static int equal(Vector a, Vector b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+	__SHLUBLU_AVX2 static int less(Vector a, Vector b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+	__SHLUBLU_AVX2 static int greaterOrEqual(Vector a, Vector b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ)); }
+};
+
+
+template<> struct __Avx2<float>
+{
+	typedef __m256 Vector;
+	static constexpr size_t width = 8;
+
+	__SHLUBLU_AVX2 static Vector load(float const* p) { return _mm256_loadu_ps(p); }
+	__SHLUBLU_AVX2 static void store(float* p, Vector v) { _mm256_storeu_ps(p, v); }
+	__SHLUBLU_AVX2 static Vector set1(float x) { return _mm256_set1_ps(x); }
+
+	__SHLUBLU_AVX2 static Vector min(Vector a, Vector b) { return _mm256_min_ps(a, b); }
+	__SHLUBLU_AVX2 static Vector max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+	__SHLUBLU_AVX2 static Vector add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+	__SHLUBLU_AVX2 static Vector sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+	__SHLUBLU_AVX2 static Vector mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+	__SHLUBLU_AVX2 static Vector div(Vector a, Vector b) { return _mm256_div_ps(a, b); }
+	__SHLUBLU_AVX2 static Vector truncate(Vector a) { return _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+	__SHLUBLU_AVX2_FMA static Vector multiplySubtract(Vector a, Vector b, Vector c) { return _mm256_fmsub_ps(a, b, c); }
+	__SHLUBLU_AVX2 static Vector copySign(Vector magnitude, Vector sign) { return _mm256_or_ps(_mm256_andnot_ps(set1(-float(0)), magnitude), _mm256_and_ps(set1(-float(0)), sign)); }
+
+	__SHLUBLU_AVX2 static int equal(Vector a, Vector b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+	__SHLUBLU_AVX2 static int less(Vector a, Vector b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+	__SHLUBLU_AVX2 static int greaterOrEqual(Vector a, Vector b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GE_OQ)); }
+};
+
+
+/*
+	AVX2 kernels.
+*/
+
+static_assert(sizeof(bool) == 1, "bool is expected to be stored on a single byte.");
+
+// Entry n holds the 4 bool values of the bits of n, in memory order
+static const uint32_t __nibbleToBools[16] =
+{
+	0x00000000, 0x00000001, 0x00000100, 0x00000101, 0x00010000, 0x00010001, 0x00010100, 0x00010101,
+	0x01000000, 0x01000001, 0x01000100, 0x01000101, 0x01010000, 0x01010001, 0x01010100, 0x01010101
+};
+
+
+template<typename T> __SHLUBLU_AVX2 static void __clampAvx2(T const* values, T* dest, size_t count, T minVal, T maxVal)
+{
+	typedef __Avx2<T> V;
+
+	const typename V::Vector minV(V::set1(minVal));
+	const typename V::Vector maxV(V::set1(maxVal));
+	size_t i(0);
+
+	for (; i + V::width <= count; i += V::width)
+	{
+		V::store(dest + i, V::max(V::min(maxV, V::load(values + i)), minV));
+	}
+
+	__clampScalar(values + i, dest + i, count - i, minVal, maxVal);
+}
+
+
+// Same operations as __roundHalfAwayFromZero(), hence the same results as the scalar kernel
+template<typename T> __SHLUBLU_AVX2 static void __roundXAvx2(T* numbers, size_t count, T factor)
+{
+	typedef __Avx2<T> V;
+
+	const typename V::Vector factorV(V::set1(factor));
+	const typename V::Vector belowHalf(V::set1(T(0.5) - std::numeric_limits<T>::epsilon() / T(4)));
+	size_t i(0);
+
+	for (; i + V::width <= count; i += V::width)
+	{
+		const typename V::Vector scaled(V::mul(factorV, V::load(numbers + i)));
+
+		V::store(numbers + i, V::div(V::truncate(V::add(scaled, V::copySign(belowHalf, scaled))), factorV));
+	}
+
+	__roundXScalar(numbers + i, count - i, factor);
+}
+
+
+template<typename T> __SHLUBLU_AVX2 static void __sameSignAvx2(T const* x, T const* y, bool* dest, size_t count)
+{
+	typedef __Avx2<T> V;
+
+	const typename V::Vector zero(V::set1(T(0)));
+	size_t i(0);
+
+	for (; i + V::width <= count; i += V::width)
+	{
+		const int mask(V::greaterOrEqual(V::load(x + i), zero) ^ V::less(V::load(y + i), zero));
+
+		for (size_t k = 0; k < V::width; k += 4)
+		{
+			std::memcpy(dest + i + k, &__nibbleToBools[(mask >> k) & 0xF], 4);
+		}
+	}
+
+	__sameSignScalar(x + i, y + i, dest + i, count - i);
+}
+
+
+template<typename T> __SHLUBLU_AVX2 static size_t __proportionalIncreaseAvx2(T const* initialValues, T const* finalValues, T* dest, size_t count)
+{
+	typedef __Avx2<T> V;
+
+	const typename V::Vector zero(V::set1(T(0)));
+	const typename V::Vector one(V::set1(T(1)));
+	size_t firstZero(count);
+	size_t i(0);
+
+	for (; i + V::width <= count; i += V::width)
+	{
+		const typename V::Vector initial(V::load(initialValues + i));
+		const int zeros(V::equal(initial, zero));
+
+		if (zeros != 0 && firstZero == count)
+		{
+			size_t k(0);
+
+			while (((zeros >> k) & 1) == 0)
+			{
+				++k;
+			}
+
+			firstZero = i + k;
+		}
+
+		V::store(dest + i, V::sub(V::div(V::load(finalValues + i), initial), one));
+	}
+
+	const size_t tailZero(__proportionalIncreaseScalar(initialValues + i, finalValues + i, dest + i, count - i));
+
+	return (firstZero == count) ? i + tailZero : firstZero;
+}
+
+
+// TwoSum, as __compensatedAdd() does
+template<typename T> __SHLUBLU_AVX2 static void __compensatedAddAvx2(typename __Avx2<T>::Vector& sum, typename __Avx2<T>::Vector& compensation, typename __Avx2<T>::Vector x)
+{
+	typedef __Avx2<T> V;
+
+	const typename V::Vector t(V::add(sum, x));
+	const typename V::Vector z(V::sub(t, sum));
+
+	compensation = V::add(compensation, V::add(V::sub(sum, V::sub(t, z)), V::sub(x, z)));
+	sum = t;
+}
+
+
+// Same algorithm as dot(T const*, T const*, size_t), each lane of the vectors being one of its accumulators
+template<typename T> __SHLUBLU_AVX2_FMA static T __dotAvx2Fma(T const* a, T const* b, size_t count)
+{
+	typedef __Avx2<T> V;
+
+	typename V::Vector sum(V::set1(T(0)));
+	typename V::Vector compensation(V::set1(T(0)));
+	size_t i(0);
+
+	for (; i + V::width <= count; i += V::width)
+	{
+		const typename V::Vector x(V::load(a + i));
+		const typename V::Vector y(V::load(b + i));
+		const typename V::Vector product(V::mul(x, y));
+
+		__compensatedAddAvx2<T>(sum, compensation, product);
+		compensation = V::add(compensation, V::multiplySubtract(x, y, product));
+
+		if ((i + V::width) % __compensatedSumRenormalizationPeriod == 0)
+		{
+			typename V::Vector renormalized(V::set1(T(0)));
+
+			__compensatedAddAvx2<T>(sum, renormalized, compensation);
+			compensation = renormalized;
+		}
+	}
+
+	T sums[V::width];
+	T compensations[V::width];
+	T retSum(0);
+	T retCompensation(0);
+
+	V::store(sums, sum);
+	V::store(compensations, compensation);
+
+	for (size_t lane = 0; lane < V::width; ++lane)
+	{
+		__compensatedAdd(retSum, retCompensation, sums[lane]);
+		retCompensation += compensations[lane];
+	}
+
+	for (; i < count; ++i)
+	{
+		const T product(a[i] * b[i]);
+
+		__compensatedAdd(retSum, retCompensation, product);
+		retCompensation += std::fma(a[i], b[i], -product);
+	}
+
+	return retSum + retCompensation;
+}
+
+
+/*
+	Vectorized logarithm and exponential used by the growth kernels.
+	They only handle positive normal arguments and results: the lanes they cannot handle are given to the scalar kernels.
+	The logarithm is the algorithm of fdlibm. The exponential reduces its argument to [-ln(2)/2, ln(2)/2], then uses a degree 13 Taylor expansion.
+	Both are accurate to about one ulp.
+*/
+
+static constexpr double __ln2Hi(6.93147180369123816490e-01); // 32 significant bits: its products with exponents are exact
+static constexpr double __ln2Lo(1.90821492927058770002e-10);
+static constexpr double __twoPow52(4503599627370496.0);
+static constexpr double __maxGrowthExponent(708.0); // exp() is normal and finite within [-708, 708]
+
+// Taylor coefficients of (exp(r) - 1) / r: a[j] = 1 / (j + 1)!
+static const double __expCoefficients[13] =
+{
+	1.0, 1.0 / 2.0, 1.0 / 6.0, 1.0 / 24.0, 1.0 / 120.0, 1.0 / 720.0, 1.0 / 5040.0,
+	1.0 / 40320.0, 1.0 / 362880.0, 1.0 / 3628800.0, 1.0 / 39916800.0, 1.0 / 479001600.0, 1.0 / 6227020800.0
+};
+
+
+__SHLUBLU_AVX2 static __m256d __expCoefficient(size_t j)
+{
+	return _mm256_set1_pd(__expCoefficients[j]);
+}
+
+
+__SHLUBLU_AVX2 static __m256d __logAvx2(__m256d x)
+{
+	const __m256d one(_mm256_set1_pd(1.0));
+	const __m256i bits(_mm256_castpd_si256(x));
+
+	// x = 2^k * m, with m within [sqrt(2)/2, sqrt(2)]
+	const __m256d biasedExponent(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(_mm256_set1_pd(__twoPow52)))));
+	const __m256d mantissa(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm256_castpd_si256(one))));
+	const __m256d above(_mm256_cmp_pd(mantissa, _mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ));
+
+	const __m256d k(_mm256_add_pd(_mm256_sub_pd(biasedExponent, _mm256_set1_pd(__twoPow52 + 1023.0)), _mm256_and_pd(above, one)));
+	const __m256d m(_mm256_blendv_pd(mantissa, _mm256_mul_pd(mantissa, _mm256_set1_pd(0.5)), above));
+
+	// log(m) = log(1 + f) = 2s + s^3 R(s^2) with s = f / (2 + f)
+	const __m256d f(_mm256_sub_pd(m, one));
+	const __m256d s(_mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f)));
+	const __m256d z(_mm256_mul_pd(s, s));
+	const __m256d w(_mm256_mul_pd(z, z));
+
+	const __m256d t1(_mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(3.999999999940941908e-01), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(2.222219843214978396e-01), _mm256_mul_pd(w, _mm256_set1_pd(1.531383769920937332e-01)))))));
+	const __m256d t2(_mm256_mul_pd(z, _mm256_add_pd(_mm256_set1_pd(6.666666666666735130e-01), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(2.857142874366239149e-01), _mm256_mul_pd(w, _mm256_add_pd(_mm256_set1_pd(1.818357216161805012e-01), _mm256_mul_pd(w, _mm256_set1_pd(1.479819860511658591e-01)))))))));
+	const __m256d r(_mm256_add_pd(t1, t2));
+	const __m256d hfsq(_mm256_mul_pd(_mm256_set1_pd(0.5), _mm256_mul_pd(f, f)));
+
+	// k ln(2) - ((hfsq - (s (hfsq + R) + k ln(2)lo)) - f)
+	const __m256d correction(_mm256_add_pd(_mm256_mul_pd(s, _mm256_add_pd(hfsq, r)), _mm256_mul_pd(k, _mm256_set1_pd(__ln2Lo))));
+
+	return _mm256_sub_pd(_mm256_mul_pd(k, _mm256_set1_pd(__ln2Hi)), _mm256_sub_pd(_mm256_sub_pd(hfsq, correction), f));
+}
+
+
+// log(1 + x), where onePlusX is the rounded sum 1 + x. The rounding error of this sum is compensated for.
+__SHLUBLU_AVX2 static __m256d __log1pAvx2(__m256d x, __m256d onePlusX)
+{
+	const __m256d roundingError(_mm256_sub_pd(x, _mm256_sub_pd(onePlusX, _mm256_set1_pd(1.0))));
+
+	return _mm256_add_pd(__logAvx2(onePlusX), _mm256_div_pd(roundingError, onePlusX));
+}
+
+
+// log(numerator / denominator), where quotient is the rounded quotient. Its rounding error, obtained by Dekker's exact product, is compensated for.
+// The result is NaN if the halves of Veltkamp's split overflow, so that __growthSlowLanes() sends such lanes to the scalar kernel.
+__SHLUBLU_AVX2 static __m256d __logQuotientAvx2(__m256d numerator, __m256d denominator, __m256d quotient)
+{
+	const __m256d splitter(_mm256_set1_pd(134217729.0));
+	const __m256d product(_mm256_mul_pd(quotient, denominator));
+
+	const __m256d quotientScaled(_mm256_mul_pd(splitter, quotient));
+	const __m256d quotientHigh(_mm256_sub_pd(quotientScaled, _mm256_sub_pd(quotientScaled, quotient)));
+	const __m256d quotientLow(_mm256_sub_pd(quotient, quotientHigh));
+	const __m256d denominatorScaled(_mm256_mul_pd(splitter, denominator));
+	const __m256d denominatorHigh(_mm256_sub_pd(denominatorScaled, _mm256_sub_pd(denominatorScaled, denominator)));
+	const __m256d denominatorLow(_mm256_sub_pd(denominator, denominatorHigh));
+
+	const __m256d productError(_mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(quotientHigh, denominatorHigh), product),
+		_mm256_mul_pd(quotientHigh, denominatorLow)), _mm256_mul_pd(quotientLow, denominatorHigh)), _mm256_mul_pd(quotientLow, denominatorLow)));
+	const __m256d roundingError(_mm256_sub_pd(_mm256_sub_pd(numerator, product), productError));
+
+	return _mm256_add_pd(__logAvx2(quotient), _mm256_div_pd(roundingError, numerator));
+}
+
+
+// exp(y) = scale * (1 + q), where scale is a power of two. This allows computing exp(y) - 1 without cancellation.
+__SHLUBLU_AVX2 static void __expAvx2(__m256d y, __m256d& scale, __m256d& q)
+{
+	const __m256d n(_mm256_round_pd(_mm256_mul_pd(y, _mm256_set1_pd(log2e<double>)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+	const __m256d r(_mm256_sub_pd(_mm256_sub_pd(y, _mm256_mul_pd(n, _mm256_set1_pd(__ln2Hi))), _mm256_mul_pd(n, _mm256_set1_pd(__ln2Lo))));
+
+	// Estrin's scheme: its dependency chains are shorter than those of Horner's
+	const __m256d r2(_mm256_mul_pd(r, r));
+	const __m256d r4(_mm256_mul_pd(r2, r2));
+	const __m256d r8(_mm256_mul_pd(r4, r4));
+
+	const __m256d p01(_mm256_add_pd(__expCoefficient(0), _mm256_mul_pd(__expCoefficient(1), r)));
+	const __m256d p23(_mm256_add_pd(__expCoefficient(2), _mm256_mul_pd(__expCoefficient(3), r)));
+	const __m256d p45(_mm256_add_pd(__expCoefficient(4), _mm256_mul_pd(__expCoefficient(5), r)));
+	const __m256d p67(_mm256_add_pd(__expCoefficient(6), _mm256_mul_pd(__expCoefficient(7), r)));
+	const __m256d p89(_mm256_add_pd(__expCoefficient(8), _mm256_mul_pd(__expCoefficient(9), r)));
+	const __m256d p1011(_mm256_add_pd(__expCoefficient(10), _mm256_mul_pd(__expCoefficient(11), r)));
+
+	const __m256d p03(_mm256_add_pd(p01, _mm256_mul_pd(p23, r2)));
+	const __m256d p47(_mm256_add_pd(p45, _mm256_mul_pd(p67, r2)));
+	const __m256d p811(_mm256_add_pd(p89, _mm256_mul_pd(p1011, r2)));
+	const __m256d p812(_mm256_add_pd(p811, _mm256_mul_pd(__expCoefficient(12), r4)));
+
+	q = _mm256_mul_pd(r, _mm256_add_pd(_mm256_add_pd(p03, _mm256_mul_pd(p47, r4)), _mm256_mul_pd(p812, r8)));
+	scale = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(n)), _mm256_set1_epi64x(1023)), 52));
+}
+
+
+// Bit k is set if the kth lane cannot be processed by __logAvx2() and __expAvx2()
+__SHLUBLU_AVX2 static int __growthSlowLanes(__m256d logArgument, __m256d expArgument)
+{
+	const __m256d absExpArgument(_mm256_andnot_pd(_mm256_set1_pd(-0.0), expArgument));
+
+	return _mm256_movemask_pd(_mm256_or_pd(
+		_mm256_or_pd(_mm256_cmp_pd(logArgument, _mm256_set1_pd(std::numeric_limits<double>::min()), _CMP_NGE_UQ), _mm256_cmp_pd(logArgument, _mm256_set1_pd(std::numeric_limits<double>::max()), _CMP_NLE_UQ)),
+		_mm256_cmp_pd(absExpArgument, _mm256_set1_pd(__maxGrowthExponent), _CMP_NLE_UQ)));
+}
+
+
+__SHLUBLU_AVX2 static __m256d __loadAsDouble(double const* p) { return _mm256_loadu_pd(p); }
+__SHLUBLU_AVX2 static __m256d __loadAsDouble(float const* p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+__SHLUBLU_AVX2 static void __storeFromDouble(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+__SHLUBLU_AVX2 static void __storeFromDouble(float* p, __m256d v) { _mm_storeu_ps(p, _mm256_cvtpd_ps(v)); }
+
+
+// Numbers of periods are converted exactly up to 2^52. Bit k of `tooLarge` is set if the kth one is greater.
+__SHLUBLU_AVX2 static __m256d __loadPeriods(size_t const* p, int& tooLarge)
+{
+	__m256i periods;
+
+	if constexpr (sizeof(size_t) == sizeof(uint64_t))
+	{
+		periods = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+	}
+	else
+	{
+		periods = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p)));
+	}
+
+	const __m256i twoPow52Bits(_mm256_castpd_si256(_mm256_set1_pd(__twoPow52)));
+
+	tooLarge = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_cmpeq_epi64(_mm256_srli_epi64(periods, 52), _mm256_setzero_si256()), _mm256_setzero_si256())));
+
+	return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(periods, twoPow52Bits)), _mm256_set1_pd(__twoPow52));
+}
+
+
+// Stores four results, those of the lanes of `slowLanes` being replaced by those of `scalar(k, result)`.
+// Inputs are not overwritten before the scalar kernel reads them, even if `dest` is one of them.
+template<typename T, typename SCALAR> __SHLUBLU_AVX2 static void __storeWithScalarFallback(T* dest, __m256d results, int slowLanes, SCALAR const& scalar)
+{
+	if (slowLanes == 0)
+	{
+		__storeFromDouble(dest, results);
+	}
+	else
+	{
+		T block[4];
+		__storeFromDouble(block, results);
+
+		for (size_t k = 0; k < 4; ++k)
+		{
+			if ((slowLanes >> k) & 1)
+			{
+				scalar(k, block + k);
+			}
+		}
+
+		std::memcpy(dest, block, sizeof(block));
+	}
+}
+
+
+/*
+	Growth kernels process blocks of 4 elements. The tails of the arrays are copied to padded blocks
+	so that all the results are computed the same way, whatever their index.
+*/
+
+template<typename T> __SHLUBLU_AVX2 static void __increaseRateBlockAvx2(T const* overallIncreases, T* dest, size_t numPeriods, size_t firstIndex)
+{
+	const __m256d one(_mm256_set1_pd(1.0));
+	const __m256d overall(__loadAsDouble(overallIncreases));
+	const __m256d base(_mm256_add_pd(one, overall));
+	const __m256d y(_mm256_div_pd(__log1pAvx2(overall, base), _mm256_set1_pd(static_cast<double>(numPeriods))));
+
+	__m256d scale, q;
+	__expAvx2(y, scale, q);
+
+	__storeWithScalarFallback(dest, _mm256_add_pd(_mm256_sub_pd(scale, one), _mm256_mul_pd(scale, q)), __growthSlowLanes(base, y),
+		[&](size_t k, T* result) { __increaseRateScalar(overallIncreases + k, result, 1, numPeriods, firstIndex + k); });
+}
+
+
+__SHLUBLU_AVX2 static void __increaseRatesBlockAvx2(double const* initialValues, double const* finalValues, size_t const* numPeriods, double* dest, size_t firstIndex)
+{
+	int tooLarge;
+	const __m256d periods(__loadPeriods(numPeriods, tooLarge));
+	const __m256d initials(_mm256_loadu_pd(initialValues));
+	const __m256d finals(_mm256_loadu_pd(finalValues));
+	const __m256d ratio(_mm256_div_pd(finals, initials));
+	const __m256d y(_mm256_div_pd(__logQuotientAvx2(finals, initials, ratio), periods));
+	const int noPeriod(_mm256_movemask_pd(_mm256_cmp_pd(periods, _mm256_setzero_pd(), _CMP_EQ_OQ)));
+
+	__m256d scale, q;
+	__expAvx2(y, scale, q);
+
+	__storeWithScalarFallback(dest, _mm256_add_pd(_mm256_sub_pd(scale, _mm256_set1_pd(1.0)), _mm256_mul_pd(scale, q)), __growthSlowLanes(ratio, y) | noPeriod | tooLarge,
+		[&](size_t k, double* result) { __increaseRatesScalar(initialValues + k, finalValues + k, numPeriods + k, result, 1, firstIndex + k); });
+}
+
+
+__SHLUBLU_AVX2 static void __compoundedValueBlockAvx2(double const* initialValues, double const* rates, size_t const* numPeriods, double* dest, size_t firstIndex)
+{
+	int tooLarge;
+	const __m256d periods(__loadPeriods(numPeriods, tooLarge));
+	const __m256d rate(_mm256_loadu_pd(rates));
+	const __m256d base(_mm256_add_pd(_mm256_set1_pd(1.0), rate));
+	const __m256d y(_mm256_mul_pd(__log1pAvx2(rate, base), periods));
+
+	__m256d scale, q;
+	__expAvx2(y, scale, q);
+
+	__storeWithScalarFallback(dest, _mm256_mul_pd(_mm256_loadu_pd(initialValues), _mm256_add_pd(scale, _mm256_mul_pd(scale, q))), __growthSlowLanes(base, y) | tooLarge,
+		[&](size_t k, double* result) { __compoundedValueScalar(initialValues + k, rates + k, numPeriods + k, result, 1, firstIndex + k); });
+}
+
+
+template<typename T> __SHLUBLU_AVX2 static void __increaseRateAvx2(T const* overallIncreases, T* dest, size_t count, size_t numPeriods)
+{
+	size_t i(0);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__increaseRateBlockAvx2(overallIncreases + i, dest + i, numPeriods, i);
+	}
+
+	if (i < count)
+	{
+		T overall[4] = { T(0), T(0), T(0), T(0) };
+		T results[4];
+
+		std::copy(overallIncreases + i, overallIncreases + count, overall);
+		__increaseRateBlockAvx2(overall, results, numPeriods, i);
+		std::copy(results, results + count - i, dest + i);
+	}
+}
+
+
+__SHLUBLU_AVX2 static void __increaseRatesAvx2(double const* initialValues, double const* finalValues, size_t const* numPeriods, double* dest, size_t count)
+{
+	size_t i(0);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__increaseRatesBlockAvx2(initialValues + i, finalValues + i, numPeriods + i, dest + i, i);
+	}
+
+	if (i < count)
+	{
+		double initial[4] = { 1.0, 1.0, 1.0, 1.0 };
+		double finalTail[4] = { 1.0, 1.0, 1.0, 1.0 };
+		size_t periods[4] = { 1, 1, 1, 1 };
+		double results[4];
+
+		std::copy(initialValues + i, initialValues + count, initial);
+		std::copy(finalValues + i, finalValues + count, finalTail);
+		std::copy(numPeriods + i, numPeriods + count, periods);
+		__increaseRatesBlockAvx2(initial, finalTail, periods, results, i);
+		std::copy(results, results + count - i, dest + i);
+	}
+}
+
+
+__SHLUBLU_AVX2 static void __compoundedValueAvx2(double const* initialValues, double const* rates, size_t const* numPeriods, double* dest, size_t count)
+{
+	size_t i(0);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__compoundedValueBlockAvx2(initialValues + i, rates + i, numPeriods + i, dest + i, i);
+	}
+
+	if (i < count)
+	{
+		double initial[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double rate[4] = { 0.0, 0.0, 0.0, 0.0 };
+		size_t periods[4] = { 0, 0, 0, 0 };
+		double results[4];
+
+		std::copy(initialValues + i, initialValues + count, initial);
+		std::copy(rates + i, rates + count, rate);
+		std::copy(numPeriods + i, numPeriods + count, periods);
+		__compoundedValueBlockAvx2(initial, rate, periods, results, i);
+		std::copy(results, results + count - i, dest + i);
+	}
+}
+
+
+/*
+	Fast approximations.
+	They perform the operations of __fastExp() and __fastLog() in the same order, so that their results are the same.
+	Polynomials are evaluated with Estrin's scheme, whose dependency chains are shorter than those of Horner's.
+*/
+
+// 2^n for an integral n within [-1022, 1023]: the biased exponent is in the lowest bits of n + 2^52 + 1023
+__SHLUBLU_AVX2 static __m256d __fastPowerOfTwoAvx2(__m256d n)
+{
+	return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(n, _mm256_set1_pd(__twoPow52 + 1023.0))), 52));
+}
+
+
+__SHLUBLU_AVX2 static __m256d __fastExpAvx2(__m256d x)
+{
+	// The order of the operands of min() and max() keeps NaN
+	const __m256d clamped(_mm256_min_pd(_mm256_set1_pd(__fastMaxExpArgument), _mm256_max_pd(_mm256_set1_pd(__fastMinExpArgument), x)));
+	const __m256d magic(_mm256_set1_pd(__fastRoundingMagic));
+	const __m256d n(_mm256_sub_pd(_mm256_add_pd(_mm256_mul_pd(clamped, _mm256_set1_pd(log2e<double>)), magic), magic));
+	const __m256d r(_mm256_sub_pd(_mm256_sub_pd(clamped, _mm256_mul_pd(n, _mm256_set1_pd(__fastLn2Hi))), _mm256_mul_pd(n, _mm256_set1_pd(__fastLn2Lo))));
+
+	const __m256d r2(_mm256_mul_pd(r, r));
+	const __m256d r4(_mm256_mul_pd(r2, r2));
+	const __m256d p01(_mm256_add_pd(_mm256_set1_pd(1.0), r));
+	const __m256d p23(_mm256_add_pd(_mm256_set1_pd(1.0 / 2.0), _mm256_mul_pd(r, _mm256_set1_pd(1.0 / 6.0))));
+	const __m256d p45(_mm256_add_pd(_mm256_set1_pd(1.0 / 24.0), _mm256_mul_pd(r, _mm256_set1_pd(1.0 / 120.0))));
+	const __m256d p67(_mm256_add_pd(_mm256_set1_pd(1.0 / 720.0), _mm256_mul_pd(r, _mm256_set1_pd(1.0 / 5040.0))));
+	const __m256d p(_mm256_add_pd(_mm256_add_pd(p01, _mm256_mul_pd(r2, p23)), _mm256_mul_pd(r4, _mm256_add_pd(p45, _mm256_mul_pd(r2, p67)))));
+
+	const __m256d half(_mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.5))));
+
+	return _mm256_mul_pd(_mm256_mul_pd(p, __fastPowerOfTwoAvx2(half)), __fastPowerOfTwoAvx2(_mm256_sub_pd(n, half)));
+}
+
+
+// Lanes that are not positive, normal and finite are not handled
+__SHLUBLU_AVX2 static __m256d __fastLogAvx2(__m256d x)
+{
+	const __m256d one(_mm256_set1_pd(1.0));
+	const __m256i bits(_mm256_castpd_si256(x));
+
+	const __m256d biasedExponent(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), _mm256_castpd_si256(_mm256_set1_pd(__twoPow52)))));
+	const __m256d mantissa(_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)), _mm256_castpd_si256(one))));
+	const __m256d above(_mm256_cmp_pd(mantissa, _mm256_set1_pd(1.41421356237309504880), _CMP_GT_OQ));
+
+	const __m256d k(_mm256_add_pd(_mm256_sub_pd(biasedExponent, _mm256_set1_pd(__twoPow52 + 1023.0)), _mm256_and_pd(above, one)));
+	const __m256d m(_mm256_blendv_pd(mantissa, _mm256_mul_pd(mantissa, _mm256_set1_pd(0.5)), above));
+
+	const __m256d f(_mm256_sub_pd(m, one));
+	const __m256d s(_mm256_div_pd(f, _mm256_add_pd(_mm256_set1_pd(2.0), f)));
+	const __m256d z(_mm256_mul_pd(s, s));
+
+	const __m256d z2(_mm256_mul_pd(z, z));
+	const __m256d p01(_mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(z, _mm256_set1_pd(1.0 / 3.0))));
+	const __m256d p23(_mm256_add_pd(_mm256_set1_pd(1.0 / 5.0), _mm256_mul_pd(z, _mm256_set1_pd(1.0 / 7.0))));
+	const __m256d p(_mm256_add_pd(p01, _mm256_mul_pd(z2, _mm256_add_pd(p23, _mm256_mul_pd(z2, _mm256_set1_pd(1.0 / 9.0))))));
+
+	const __m256d series(_mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(2.0), s), p));
+
+	return _mm256_add_pd(_mm256_mul_pd(k, _mm256_set1_pd(__fastLn2Hi)), _mm256_add_pd(_mm256_mul_pd(k, _mm256_set1_pd(__fastLn2Lo)), series));
+}
+
+
+__SHLUBLU_AVX2 static int __fastLogSlowLanes(__m256d x)
+{
+	return _mm256_movemask_pd(_mm256_or_pd(
+		_mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::min()), _CMP_NGE_UQ),
+		_mm256_cmp_pd(x, _mm256_set1_pd(std::numeric_limits<double>::max()), _CMP_NLE_UQ)));
+}
+
+
+struct __FastExpAvx2
+{
+	__SHLUBLU_AVX2 static __m256d vector(__m256d x) { return __fastExpAvx2(x); }
+	__SHLUBLU_AVX2 static int slowLanes(__m256d) { return 0; }
+	static double scalar(double x) { return __fastExp(x); }
+};
+
+
+struct __FastLogAvx2
+{
+	__SHLUBLU_AVX2 static __m256d vector(__m256d x) { return __fastLogAvx2(x); }
+	__SHLUBLU_AVX2 static int slowLanes(__m256d x) { return __fastLogSlowLanes(x); }
+	static double scalar(double x) { return __fastLog(x); }
+};
+
+
+struct __FastSigmoidAvx2
+{
+	__SHLUBLU_AVX2 static __m256d vector(__m256d x)
+	{
+		const __m256d one(_mm256_set1_pd(1.0));
+
+		return _mm256_div_pd(one, _mm256_add_pd(one, __fastExpAvx2(_mm256_xor_pd(x, _mm256_set1_pd(-0.0)))));
+	}
+
+	__SHLUBLU_AVX2 static int slowLanes(__m256d) { return 0; }
+	static double scalar(double x) { return __fastSigmoid(x); }
+};
+
+
+template<typename T, typename FUNCTION> __SHLUBLU_AVX2 static void __fastUnaryBlockAvx2(T const* x, T* dest)
+{
+	const __m256d v(__loadAsDouble(x));
+
+	__storeWithScalarFallback(dest, FUNCTION::vector(v), FUNCTION::slowLanes(v), [x](size_t k, T* result) { *result = T(FUNCTION::scalar(double(x[k]))); });
+}
+
+
+template<typename T, typename FUNCTION> __SHLUBLU_AVX2 static void __fastUnaryAvx2(T const* x, T* dest, size_t count)
+{
+	size_t i(0);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__fastUnaryBlockAvx2<T, FUNCTION>(x + i, dest + i);
+	}
+
+	if (i < count)
+	{
+		T tail[4] = { T(1), T(1), T(1), T(1) };
+
+		std::copy(x + i, x + count, tail);
+		__fastUnaryBlockAvx2<T, FUNCTION>(tail, tail);
+		std::copy(tail, tail + count - i, dest + i);
+	}
+}
+
+
+template<typename T> __SHLUBLU_AVX2 static void __fastPowBlockAvx2(T const* x, T const* y, T* dest)
+{
+	const __m256d base(__loadAsDouble(x));
+	const __m256d exponent(__loadAsDouble(y));
+	const __m256d absExponent(_mm256_andnot_pd(_mm256_set1_pd(-0.0), exponent));
+	const int slowLanes(__fastLogSlowLanes(base) | _mm256_movemask_pd(_mm256_cmp_pd(absExponent, _mm256_set1_pd(std::numeric_limits<double>::max()), _CMP_NLE_UQ)));
+
+	__storeWithScalarFallback(dest, __fastExpAvx2(_mm256_mul_pd(exponent, __fastLogAvx2(base))), slowLanes,
+		[x, y](size_t k, T* result) { *result = T(__fastPow(double(x[k]), double(y[k]))); });
+}
+
+
+template<typename T> __SHLUBLU_AVX2 static void __fastPowAvx2(T const* x, T const* y, T* dest, size_t count)
+{
+	size_t i(0);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		__fastPowBlockAvx2(x + i, y + i, dest + i);
+	}
+
+	if (i < count)
+	{
+		T tailX[4] = { T(1), T(1), T(1), T(1) };
+		T tailY[4] = { T(1), T(1), T(1), T(1) };
+
+		std::copy(x + i, x + count, tailX);
+		std::copy(y + i, y + count, tailY);
+		__fastPowBlockAvx2(tailX, tailY, tailX);
+		std::copy(tailX, tailX + count - i, dest + i);
+	}
+}
+
+#endif
+
+
+static bool __hasAvx2()
+{
+	bool ret(false);
+
+#ifdef __SHLUBLU_X86
+#ifdef _WIN32
+	int info[4];
+
+	__cpuid(info, 0);
+
+	if (info[0] >= 7)
+	{
+		__cpuid(info, 1);
+
+		const bool osUsesXsave((info[2] & (1 << 27)) != 0);
+		const bool cpuHasAvx((info[2] & (1 << 28)) != 0);
+
+		if (osUsesXsave && cpuHasAvx && (_xgetbv(0) & 0x6) == 0x6)
+		{
+			__cpuidex(info, 7, 0);
+			ret = (info[1] & (1 << 5)) != 0;
+		}
+	}
+#else
+	__builtin_cpu_init();
+	ret = __builtin_cpu_supports("avx2") != 0;
+#endif
+#endif
+
+	return ret;
+}
+
+
+static bool __hasFma()
+{
+	bool ret(false);
+
+#ifdef __SHLUBLU_X86
+#ifdef _WIN32
+	int info[4];
+
+	__cpuid(info, 1);
+	ret = (info[2] & (1 << 12)) != 0;
+#else
+	__builtin_cpu_init();
+	ret = __builtin_cpu_supports("fma") != 0;
+#endif
+#endif
+
+	return ret;
+}
+
+
+template<typename T> struct __BatchKernels
+{
+	void (*roundX)(T*, size_t, T);
+	void (*clamp)(T const*, T*, size_t, T, T);
+	void (*sameSign)(T const*, T const*, bool*, size_t);
+	size_t (*proportionalIncrease)(T const*, T const*, T*, size_t);
+	void (*fastExp)(T const*, T*, size_t);
+	void (*fastLog)(T const*, T*, size_t);
+	void (*fastPow)(T const*, T const*, T*, size_t);
+	void (*fastSigmoid)(T const*, T*, size_t);
+};
+
+
+// Selected once, at first use, according to what the CPU supports
+template<typename T> static __BatchKernels<T> const& __batchKernels()
+{
+	static const __BatchKernels<T> scalarKernels{ __roundXScalar<T>, __clampScalar<T>, __sameSignScalar<T>, __proportionalIncreaseScalar<T>, __fastExpScalar<T>, __fastLogScalar<T>, __fastPowScalar<T>, __fastSigmoidScalar<T> };
+
+#ifdef __SHLUBLU_X86
+	static const __BatchKernels<T> kernels(__hasAvx2()
+		? __BatchKernels<T>{ __roundXAvx2<T>, __clampAvx2<T>, __sameSignAvx2<T>, __proportionalIncreaseAvx2<T>, __fastUnaryAvx2<T, __FastExpAvx2>, __fastUnaryAvx2<T, __FastLogAvx2>, __fastPowAvx2<T>, __fastUnaryAvx2<T, __FastSigmoidAvx2> }
+		: scalarKernels);
+#else
+	static const __BatchKernels<T>& kernels(scalarKernels);
+#endif
+
+	return kernels;
+}
+
+
+template<typename T> static void __clampBatch(T const* values, T* dest, size_t count, T minVal, T maxVal)
+{
+	if (minVal > maxVal)
+	{
+		throw std::invalid_argument("Math::clamp(): " + String::xtos(minVal) + " > " + String::xtos(maxVal));
+	}
+
+	__batchKernels<T>().clamp(values, dest, count, minVal, maxVal);
+}
+
+
+template<typename T> static void __proportionalIncreaseBatch(T const* initialValues, T const* finalValues, T* dest, size_t count)
+{
+	const size_t firstZero(__batchKernels<T>().proportionalIncrease(initialValues, finalValues, dest, count));
+
+	if (firstZero != count)
+	{
+		throw std::invalid_argument("Math::proportionalIncrease(): initialValues[" + String::xtos(firstZero) + "] should not be zero.");
+	}
+}
+
+
+// dot() is not part of __BatchKernels<T> as its kernel also needs FMA
+template<typename T> static T __dotBatch(T const* a, T const* b, size_t count)
+{
+#ifdef __SHLUBLU_X86
+	static const bool avx2Fma(__hasAvx2() && __hasFma());
+
+	if (avx2Fma)
+	{
+		return __dotAvx2Fma(a, b, count);
+	}
+#endif
+
+	return dot<T>(a, b, count);
+}
+
+
+// Growth functions are not part of __BatchKernels<T> as some of them only exist for double
+static bool __growthUsesAvx2()
+{
+	static const bool ret(__hasAvx2());
+
+	return ret;
+}
+
+
+template<typename T> static void __increaseRateBatch(T const* overallIncreases, T* dest, size_t count, size_t numPeriods)
+{
+	if (numPeriods == 0)
+	{
+		throw std::invalid_argument("Math::increaseRate(): numPeriods (" + String::xtos(numPeriods) + ") should be strictly positive.");
+	}
+
+#ifdef __SHLUBLU_X86
+	if (__growthUsesAvx2())
+	{
+		__increaseRateAvx2(overallIncreases, dest, count, numPeriods);
+		return;
+	}
+#endif
+
+	__increaseRateScalar(overallIncreases, dest, count, numPeriods, 0);
+}
+
+/// @endcond
+
+
+void roundX(double* numbers, size_t count, size_t digits)
+{
+	__batchKernels<double>().roundX(numbers, count, powerOfTen<double>(digits));
+}
+
+
+void roundX(float* numbers, size_t count, size_t digits)
+{
+	__batchKernels<float>().roundX(numbers, count, powerOfTen<float>(digits));
+}
+
+
+double dot(double const* a, double const* b, size_t count)
+{
+	return __dotBatch(a, b, count);
+}
+
+
+float dot(float const* a, float const* b, size_t count)
+{
+	return __dotBatch(a, b, count);
+}
+
+
+void clamp(float const* values, float* dest, size_t count, float minVal, float maxVal)
+{
+	__clampBatch(values, dest, count, minVal, maxVal);
+}
+
+
+void clamp(double const* values, double* dest, size_t count, double minVal, double maxVal)
+{
+	__clampBatch(values, dest, count, minVal, maxVal);
+}
+
+
+void sameSign(float const* x, float const* y, bool* dest, size_t count)
+{
+	__batchKernels<float>().sameSign(x, y, dest, count);
+}
+
+
+void sameSign(double const* x, double const* y, bool* dest, size_t count)
+{
+	__batchKernels<double>().sameSign(x, y, dest, count);
+}
+
+
+void proportionalIncrease(float const* initialValues, float const* finalValues, float* dest, size_t count)
+{
+	__proportionalIncreaseBatch(initialValues, finalValues, dest, count);
+}
+
+
+void proportionalIncrease(double const* initialValues, double const* finalValues, double* dest, size_t count)
+{
+	__proportionalIncreaseBatch(initialValues, finalValues, dest, count);
+}
+
+
+void increaseRate(float const* overallIncreases, float* dest, size_t count, size_t numPeriods)
+{
+	__increaseRateBatch(overallIncreases, dest, count, numPeriods);
+}
+
+
+void increaseRate(double const* overallIncreases, double* dest, size_t count, size_t numPeriods)
+{
+	__increaseRateBatch(overallIncreases, dest, count, numPeriods);
+}
+
+
+void increaseRate(double const* initialValues, double const* finalValues, size_t const* numPeriods, double* dest, size_t count)
+{
+#ifdef __SHLUBLU_X86
+	if (__growthUsesAvx2())
+	{
+		__increaseRatesAvx2(initialValues, finalValues, numPeriods, dest, count);
+		return;
+	}
+#endif
+
+	__increaseRatesScalar(initialValues, finalValues, numPeriods, dest, count, 0);
+}
+
+
+void compoundedValue(double const* initialValues, double const* rates, size_t const* numPeriods, double* dest, size_t count)
+{
+#ifdef __SHLUBLU_X86
+	if (__growthUsesAvx2())
+	{
+		__compoundedValueAvx2(initialValues, rates, numPeriods, dest, count);
+		return;
+	}
+#endif
+
+	__compoundedValueScalar(initialValues, rates, numPeriods, dest, count, 0);
+}
+
+
+
+void fastExp(float const* x, float* dest, size_t count)
+{
+	__batchKernels<float>().fastExp(x, dest, count);
+}
+
+
+void fastExp(double const* x, double* dest, size_t count)
+{
+	__batchKernels<double>().fastExp(x, dest, count);
+}
+
+
+void fastLog(float const* x, float* dest, size_t count)
+{
+	__batchKernels<float>().fastLog(x, dest, count);
+}
+
+
+void fastLog(double const* x, double* dest, size_t count)
+{
+	__batchKernels<double>().fastLog(x, dest, count);
+}
+
+
+void fastPow(float const* x, float const* y, float* dest, size_t count)
+{
+	__batchKernels<float>().fastPow(x, y, dest, count);
+}
+
+
+void fastPow(double const* x, double const* y, double* dest, size_t count)
+{
+	__batchKernels<double>().fastPow(x, y, dest, count);
+}
+
+
+void fastSigmoid(float const* x, float* dest, size_t count)
+{
+	__batchKernels<float>().fastSigmoid(x, dest, count);
+}
+
+
+void fastSigmoid(double const* x, double* dest, size_t count)
+{
+	__batchKernels<double>().fastSigmoid(x, dest, count);
+}
+
+}
+
+}
@@ -0,0 +1,370 @@
+#include <shlublu/math/Rolling.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include <shlublu/math/Math.h>
+#include <shlublu/text/String.h>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+RollingStatistics::RollingStatistics(size_t windowSize)
+	: mValues(),
+	mNext(0),
+	mCount(0),
+	mUpdatesSinceResync(0),
+	mSum(0.0),
+	mCompensation(0.0),
+	mM2(0.0)
+{
+	if (windowSize == 0)
+	{
+		throw std::invalid_argument("Math::RollingStatistics::RollingStatistics(): windowSize should not be zero.");
+	}
+
+	mValues.resize(windowSize);
+}
+
+
+void RollingStatistics::reset()
+{
+	mNext = 0;
+	mCount = 0;
+	mUpdatesSinceResync = 0;
+	mSum = 0.0;
+	mCompensation = 0.0;
+	mM2 = 0.0;
+}
+
+
+void RollingStatistics::push(double value)
+{
+	const size_t size(mValues.size());
+	const double previousMean((mCount > 0) ? sum() / double(mCount) : 0.0);
+
+	if (mCount < size)
+	{
+		++mCount;
+		__compensatedAdd(mSum, mCompensation, value);
+
+		mM2 += (value - previousMean) * (value - sum() / double(mCount));
+	}
+	else
+	{
+		const double oldest(mValues[mNext]);
+
+		__compensatedAdd(mSum, mCompensation, value);
+		__compensatedAdd(mSum, mCompensation, -oldest);
+
+		// Removing the oldest value and adding the new one at once, as Welford's update does for a single value
+		mM2 += (value - oldest) * ((value - sum() / double(size)) + (oldest - previousMean));
+		mM2 = std::max(mM2, 0.0);
+	}
+
+	mValues[mNext] = value;
+	mNext = (mNext + 1 == size) ? 0 : mNext + 1;
+
+	if (mCount == size && ++mUpdatesSinceResync == size)
+	{
+		resynchronize();
+	}
+}
+
+
+void RollingStatistics::push(double const* values, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		push(values[i]);
+	}
+}
+
+
+size_t RollingStatistics::windowSize() const
+{
+	return mValues.size();
+}
+
+
+size_t RollingStatistics::count() const
+{
+	return mCount;
+}
+
+
+bool RollingStatistics::full() const
+{
+	return mCount == mValues.size();
+}
+
+
+double RollingStatistics::sum() const
+{
+	return mSum + mCompensation;
+}
+
+
+double RollingStatistics::mean() const
+{
+	checkNotEmpty("mean");
+
+	return sum() / double(mCount);
+}
+
+
+double RollingStatistics::variance() const
+{
+	checkNotEmpty("variance");
+
+	return mM2 / double(mCount);
+}
+
+
+double RollingStatistics::sampleVariance() const
+{
+	if (mCount < 2)
+	{
+		throw std::domain_error("Math::RollingStatistics::sampleVariance(): at least two values are needed.");
+	}
+
+	return mM2 / double(mCount - 1);
+}
+
+
+double RollingStatistics::standardDeviation() const
+{
+	return std::sqrt(variance());
+}
+
+
+void RollingStatistics::checkNotEmpty(const char* caller) const
+{
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::RollingStatistics::" + std::string(caller) + "(): the window is empty.");
+	}
+}
+
+
+// The window is full: all the values of the buffer are in it, whatever their order
+void RollingStatistics::resynchronize()
+{
+	const double n(static_cast<double>(mCount));
+
+	mSum = compensatedSum(mValues.data(), mCount);
+	mCompensation = 0.0;
+
+	const double mean(mSum / n);
+	double squares(0.0);
+	double deviations(0.0);
+
+	for (const auto& value : mValues)
+	{
+		squares += (value - mean) * (value - mean);
+		deviations += value - mean;
+	}
+
+	// Corrected two-pass algorithm: the second term compensates for the rounding error of the mean
+	mM2 = std::max(squares - deviations * deviations / n, 0.0);
+	mUpdatesSinceResync = 0;
+}
+
+
+RollingExtrema::RollingExtrema(size_t windowSize)
+	: mValues(),
+	mPushed(0),
+	mMinQueue{ std::vector<uint64_t>(windowSize), 0, 0 },
+	mMaxQueue{ std::vector<uint64_t>(windowSize), 0, 0 }
+{
+	if (windowSize == 0)
+	{
+		throw std::invalid_argument("Math::RollingExtrema::RollingExtrema(): windowSize should not be zero.");
+	}
+
+	mValues.resize(windowSize);
+}
+
+
+void RollingExtrema::reset()
+{
+	mPushed = 0;
+	mMinQueue.front = mMinQueue.size = 0;
+	mMaxQueue.front = mMaxQueue.size = 0;
+}
+
+
+void RollingExtrema::push(double value)
+{
+	if (std::isnan(value))
+	{
+		throw std::invalid_argument("Math::RollingExtrema::push(): value should not be NaN.");
+	}
+
+	// Queues are updated first: the slot of the new value may still hold a value they refer to
+	update(mMinQueue, value, [](double queued, double added) { return queued < added; });
+	update(mMaxQueue, value, [](double queued, double added) { return queued > added; });
+
+	mValues[mPushed % mValues.size()] = value;
+	++mPushed;
+}
+
+
+void RollingExtrema::push(double const* values, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		push(values[i]);
+	}
+}
+
+
+size_t RollingExtrema::windowSize() const
+{
+	return mValues.size();
+}
+
+
+size_t RollingExtrema::count() const
+{
+	return size_t(std::min<uint64_t>(mPushed, mValues.size()));
+}
+
+
+bool RollingExtrema::full() const
+{
+	return mPushed >= mValues.size();
+}
+
+
+double RollingExtrema::min() const
+{
+	checkNotEmpty("min");
+
+	return mValues[mMinQueue.positions[mMinQueue.front] % mValues.size()];
+}
+
+
+double RollingExtrema::max() const
+{
+	checkNotEmpty("max");
+
+	return mValues[mMaxQueue.positions[mMaxQueue.front] % mValues.size()];
+}
+
+
+// Values that leave the window are removed from the front. Values that can no longer be extrema, because the new value is better
+// and will stay in the window longer than them, are removed from the back. The front then holds the extremum.
+template<typename BEFORE> void RollingExtrema::update(MonotonicQueue& queue, double value, BEFORE before)
+{
+	const size_t size(mValues.size());
+
+	if (queue.size > 0 && queue.positions[queue.front] + size <= mPushed)
+	{
+		queue.front = (queue.front + 1 == size) ? 0 : queue.front + 1;
+		--queue.size;
+	}
+
+	while (queue.size > 0)
+	{
+		const size_t back((queue.front + queue.size - 1) % size);
+
+		if (before(mValues[queue.positions[back] % size], value))
+		{
+			break;
+		}
+
+		--queue.size;
+	}
+
+	queue.positions[(queue.front + queue.size) % size] = mPushed;
+	++queue.size;
+}
+
+
+void RollingExtrema::checkNotEmpty(const char* caller) const
+{
+	if (mPushed == 0)
+	{
+		throw std::domain_error("Math::RollingExtrema::" + std::string(caller) + "(): the window is empty.");
+	}
+}
+
+
+ExponentialMovingAverage::ExponentialMovingAverage(double alpha)
+	: mAlpha(alpha),
+	mCount(0),
+	mValue(0.0)
+{
+	if (!(alpha > 0.0 && alpha <= 1.0))
+	{
+		throw std::invalid_argument("Math::ExponentialMovingAverage::ExponentialMovingAverage(): alpha (" + String::xtos(alpha) + ") should be within ]0, 1].");
+	}
+}
+
+
+ExponentialMovingAverage ExponentialMovingAverage::fromSpan(size_t span)
+{
+	if (span == 0)
+	{
+		throw std::invalid_argument("Math::ExponentialMovingAverage::fromSpan(): span should not be zero.");
+	}
+
+	return ExponentialMovingAverage(2.0 / (static_cast<double>(span) + 1.0));
+}
+
+
+void ExponentialMovingAverage::reset()
+{
+	mCount = 0;
+	mValue = 0.0;
+}
+
+
+void ExponentialMovingAverage::push(double value)
+{
+	mValue = (mCount == 0) ? value : mValue + mAlpha * (value - mValue);
+	++mCount;
+}
+
+
+void ExponentialMovingAverage::push(double const* values, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		push(values[i]);
+	}
+}
+
+
+double ExponentialMovingAverage::alpha() const
+{
+	return mAlpha;
+}
+
+
+size_t ExponentialMovingAverage::count() const
+{
+	return mCount;
+}
+
+
+double ExponentialMovingAverage::value() const
+{
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::ExponentialMovingAverage::value(): no value has been pushed.");
+	}
+
+	return mValue;
+}
+
+}
+
+}
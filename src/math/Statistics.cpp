@@ -0,0 +1,274 @@
+#include <shlublu/math/Statistics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/// @cond INTERNAL
+
+// Small enough for a block to stay in L1 cache between the two passes
+static constexpr size_t __statisticsBlockSize(256);
+
+/// @endcond
+
+
+Statistics::Statistics()
+	: mCount(0),
+	mMean(0.0),
+	mM2(0.0),
+	mM3(0.0),
+	mM4(0.0),
+	mMin(std::numeric_limits<double>::infinity()),
+	mMax(-std::numeric_limits<double>::infinity())
+{}
+
+
+void Statistics::reset()
+{
+	*this = Statistics();
+}
+
+
+void Statistics::push(double value)
+{
+	const double n1(static_cast<double>(mCount));
+	const double n(n1 + 1.0);
+	const double delta(value - mMean);
+	const double deltaN(delta / n);
+	const double deltaN2(deltaN * deltaN);
+	const double term1(delta * deltaN * n1);
+
+	++mCount;
+	mMean += deltaN;
+	mM4 += term1 * deltaN2 * (n * n - 3.0 * n + 3.0) + 6.0 * deltaN2 * mM2 - 4.0 * deltaN * mM3;
+	mM3 += term1 * deltaN * (n - 2.0) - 3.0 * deltaN * mM2;
+	mM2 += term1;
+	mMin = std::min(mMin, value);
+	mMax = std::max(mMax, value);
+}
+
+
+void Statistics::push(double const* values, size_t count)
+{
+	for (size_t start = 0; start < count; start += __statisticsBlockSize)
+	{
+		double const* block(values + start);
+		const size_t size(std::min(__statisticsBlockSize, count - start));
+
+		// Four independent accumulators let the compiler interleave or vectorize the loops
+		double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double minVal[4] = { mMin, mMin, mMin, mMin };
+		double maxVal[4] = { mMax, mMax, mMax, mMax };
+		size_t i(0);
+
+		for (; i + 4 <= size; i += 4)
+		{
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				sum[lane] += block[i + lane];
+				minVal[lane] = std::min(minVal[lane], block[i + lane]);
+				maxVal[lane] = std::max(maxVal[lane], block[i + lane]);
+			}
+		}
+
+		for (; i < size; ++i)
+		{
+			sum[0] += block[i];
+			minVal[0] = std::min(minVal[0], block[i]);
+			maxVal[0] = std::max(maxVal[0], block[i]);
+		}
+
+		Statistics blockStats;
+
+		blockStats.mCount = size;
+		blockStats.mMean = ((sum[0] + sum[1]) + (sum[2] + sum[3])) / double(size);
+		blockStats.mMin = std::min(std::min(minVal[0], minVal[1]), std::min(minVal[2], minVal[3]));
+		blockStats.mMax = std::max(std::max(maxVal[0], maxVal[1]), std::max(maxVal[2], maxVal[3]));
+
+		double m2[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double m3[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double m4[4] = { 0.0, 0.0, 0.0, 0.0 };
+
+		for (i = 0; i + 4 <= size; i += 4)
+		{
+			for (size_t lane = 0; lane < 4; ++lane)
+			{
+				const double d(block[i + lane] - blockStats.mMean);
+				const double d2(d * d);
+
+				m2[lane] += d2;
+				m3[lane] += d2 * d;
+				m4[lane] += d2 * d2;
+			}
+		}
+
+		for (; i < size; ++i)
+		{
+			const double d(block[i] - blockStats.mMean);
+			const double d2(d * d);
+
+			m2[0] += d2;
+			m3[0] += d2 * d;
+			m4[0] += d2 * d2;
+		}
+
+		blockStats.mM2 = (m2[0] + m2[1]) + (m2[2] + m2[3]);
+		blockStats.mM3 = (m3[0] + m3[1]) + (m3[2] + m3[3]);
+		blockStats.mM4 = (m4[0] + m4[1]) + (m4[2] + m4[3]);
+
+		merge(blockStats);
+	}
+}
+
+
+void Statistics::push(std::vector<double> const& values)
+{
+	push(values.data(), values.size());
+}
+
+
+void Statistics::merge(Statistics const& other)
+{
+	if (other.mCount == 0)
+	{
+		return;
+	}
+
+	if (mCount == 0)
+	{
+		*this = other;
+		return;
+	}
+
+	const Statistics a(*this);
+	const double na(static_cast<double>(a.mCount));
+	const double nb(static_cast<double>(other.mCount));
+	const double n(na + nb);
+	const double delta(other.mMean - a.mMean);
+	const double delta2(delta * delta);
+
+	mCount = a.mCount + other.mCount;
+	mMean = a.mMean + delta * nb / n;
+	mM2 = a.mM2 + other.mM2 + delta2 * na * nb / n;
+	mM3 = a.mM3 + other.mM3
+		+ delta2 * delta * na * nb * (na - nb) / (n * n)
+		+ 3.0 * delta * (na * other.mM2 - nb * a.mM2) / n;
+	mM4 = a.mM4 + other.mM4
+		+ delta2 * delta2 * na * nb * (na * na - na * nb + nb * nb) / (n * n * n)
+		+ 6.0 * delta2 * (na * na * other.mM2 + nb * nb * a.mM2) / (n * n)
+		+ 4.0 * delta * (na * other.mM3 - nb * a.mM3) / n;
+	mMin = std::min(a.mMin, other.mMin);
+	mMax = std::max(a.mMax, other.mMax);
+}
+
+
+size_t Statistics::count() const
+{
+	return mCount;
+}
+
+
+double Statistics::mean() const
+{
+	checkNotEmpty("mean");
+
+	return mMean;
+}
+
+
+double Statistics::variance() const
+{
+	checkNotEmpty("variance");
+
+	return mM2 / double(mCount);
+}
+
+
+double Statistics::sampleVariance() const
+{
+	if (mCount < 2)
+	{
+		throw std::domain_error("Math::Statistics::sampleVariance(): at least two values are needed.");
+	}
+
+	return mM2 / double(mCount - 1);
+}
+
+
+double Statistics::standardDeviation() const
+{
+	checkNotEmpty("standardDeviation");
+
+	return std::sqrt(variance());
+}
+
+
+double Statistics::min() const
+{
+	checkNotEmpty("min");
+
+	return mMin;
+}
+
+
+double Statistics::max() const
+{
+	checkNotEmpty("max");
+
+	return mMax;
+}
+
+
+double Statistics::skewness() const
+{
+	checkNotEmpty("skewness");
+	checkNotConstant("skewness");
+
+	return std::sqrt(double(mCount)) * mM3 / std::pow(mM2, 1.5);
+}
+
+
+double Statistics::kurtosis() const
+{
+	checkNotEmpty("kurtosis");
+	checkNotConstant("kurtosis");
+
+	return double(mCount) * mM4 / (mM2 * mM2);
+}
+
+
+double Statistics::excessKurtosis() const
+{
+	return kurtosis() - 3.0;
+}
+
+
+void Statistics::checkNotEmpty(const char* caller) const
+{
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::Statistics::" + std::string(caller) + "(): no value has been pushed.");
+	}
+}
+
+
+void Statistics::checkNotConstant(const char* caller) const
+{
+	if (mM2 == 0.0)
+	{
+		throw std::domain_error("Math::Statistics::" + std::string(caller) + "(): all values are equal.");
+	}
+}
+
+}
+
+}
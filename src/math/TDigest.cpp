@@ -0,0 +1,432 @@
+#include <shlublu/math/TDigest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include <shlublu/math/Math.h>
+#include <shlublu/text/String.h>
+
+
+namespace shlublu
+{
+
+namespace Math
+{
+
+/// @cond INTERNAL
+
+// Serialized format: magic, version, compression, count, min, max, number of centroids, then (mean, weight) pairs. Little-endian.
+static const uint8_t __tDigestMagic[4] = { 'T', 'D', 'G', 1 };
+static constexpr size_t __tDigestHeaderSize(sizeof(__tDigestMagic) + 5 * sizeof(uint64_t));
+
+
+// Values are buffered and sorted by batches, which amortizes the cost of merging them into the centroids
+static size_t __tDigestBufferSize(double compression)
+{
+	return size_t(5.0 * compression);
+}
+
+
+// Scale function k1: centroids may span one unit of k at most, which keeps them small near q = 0 and q = 1
+static double __kOfQ(double q, double compression)
+{
+	return compression / (2.0 * pi<double>) * std::asin(2.0 * std::min(1.0, std::max(0.0, q)) - 1.0);
+}
+
+
+static double __qOfK(double k, double compression)
+{
+	return (k >= compression / 4.0) ? 1.0 : (std::sin(k * 2.0 * pi<double> / compression) + 1.0) / 2.0;
+}
+
+
+static void __writeUint64(std::vector<uint8_t>& bytes, uint64_t value)
+{
+	for (size_t i = 0; i < sizeof(value); ++i)
+	{
+		bytes.push_back(uint8_t(value >> (8 * i)));
+	}
+}
+
+
+static void __writeDouble(std::vector<uint8_t>& bytes, double value)
+{
+	uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+
+	__writeUint64(bytes, bits);
+}
+
+
+static uint64_t __readUint64(uint8_t const* bytes)
+{
+	uint64_t ret(0);
+
+	for (size_t i = 0; i < sizeof(ret); ++i)
+	{
+		ret |= uint64_t(bytes[i]) << (8 * i);
+	}
+
+	return ret;
+}
+
+
+static double __readDouble(uint8_t const* bytes)
+{
+	const uint64_t bits(__readUint64(bytes));
+	double ret;
+
+	std::memcpy(&ret, &bits, sizeof(ret));
+
+	return ret;
+}
+
+/// @endcond
+
+
+TDigest::TDigest(double compression)
+	: mCompression(compression),
+	mCount(0),
+	mMin(std::numeric_limits<double>::infinity()),
+	mMax(-std::numeric_limits<double>::infinity()),
+	mCentroids(),
+	mBuffer()
+{
+	// Also rejects NaN
+	if (!(compression >= minCompression && compression <= maxCompression))
+	{
+		throw std::invalid_argument("Math::TDigest::TDigest(): compression (" + String::xtos(compression) + ") should be within [" + String::xtos(minCompression) + ", " + String::xtos(maxCompression) + "].");
+	}
+
+	mBuffer.reserve(__tDigestBufferSize(compression));
+}
+
+
+double TDigest::compression() const
+{
+	return mCompression;
+}
+
+
+void TDigest::push(double value)
+{
+	if (std::isnan(value))
+	{
+		throw std::invalid_argument("Math::TDigest::push(): value should not be NaN.");
+	}
+
+	if (mBuffer.size() >= __tDigestBufferSize(mCompression))
+	{
+		compress();
+	}
+
+	mBuffer.push_back({ value, 1.0 });
+	++mCount;
+	mMin = std::min(mMin, value);
+	mMax = std::max(mMax, value);
+}
+
+
+void TDigest::push(double const* values, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		push(values[i]);
+	}
+}
+
+
+void TDigest::push(std::vector<double> const& values)
+{
+	push(values.data(), values.size());
+}
+
+
+void TDigest::merge(TDigest const& other)
+{
+	if (&other == this)
+	{
+		const TDigest copy(other);
+		merge(copy);
+	}
+	else if (other.mCount > 0)
+	{
+		mBuffer.insert(mBuffer.end(), other.mCentroids.begin(), other.mCentroids.end());
+		mBuffer.insert(mBuffer.end(), other.mBuffer.begin(), other.mBuffer.end());
+
+		mCount += other.mCount;
+		mMin = std::min(mMin, other.mMin);
+		mMax = std::max(mMax, other.mMax);
+
+		compress();
+	}
+}
+
+
+uint64_t TDigest::count() const
+{
+	return mCount;
+}
+
+
+double TDigest::min() const
+{
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::TDigest::min(): the digest is empty.");
+	}
+
+	return mMin;
+}
+
+
+double TDigest::max() const
+{
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::TDigest::max(): the digest is empty.");
+	}
+
+	return mMax;
+}
+
+
+double TDigest::quantile(double q) const
+{
+	if (!(q >= 0.0 && q <= 1.0))
+	{
+		throw std::invalid_argument("Math::TDigest::quantile(): q (" + String::xtos(q) + ") should be within [0, 1].");
+	}
+
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::TDigest::quantile(): the digest is empty.");
+	}
+
+	compress();
+
+	// Piecewise linear interpolation between (0, min), the centers of the centroids, and (count, max)
+	const double index(q * double(mCount));
+	double previousPosition(0.0);
+	double previousValue(mMin);
+	double weightSoFar(0.0);
+
+	for (const auto& centroid : mCentroids)
+	{
+		const double position(weightSoFar + centroid.weight / 2.0);
+
+		if (index < position)
+		{
+			return previousValue + (centroid.mean - previousValue) * (index - previousPosition) / (position - previousPosition);
+		}
+
+		previousPosition = position;
+		previousValue = centroid.mean;
+		weightSoFar += centroid.weight;
+	}
+
+	const double lastPosition(static_cast<double>(mCount));
+
+	return (lastPosition > previousPosition)
+		? previousValue + (mMax - previousValue) * (index - previousPosition) / (lastPosition - previousPosition)
+		: mMax;
+}
+
+
+double TDigest::cdf(double x) const
+{
+	if (mCount == 0)
+	{
+		throw std::domain_error("Math::TDigest::cdf(): the digest is empty.");
+	}
+
+	double ret(1.0);
+
+	if (x < mMin)
+	{
+		ret = 0.0;
+	}
+	else if (x < mMax)
+	{
+		compress();
+
+		// Inverse of the interpolation used by quantile()
+		double previousPosition(0.0);
+		double previousValue(mMin);
+		double weightSoFar(0.0);
+		bool found(false);
+
+		for (const auto& centroid : mCentroids)
+		{
+			const double position(weightSoFar + centroid.weight / 2.0);
+
+			if (x < centroid.mean)
+			{
+				ret = (previousPosition + (position - previousPosition) * (x - previousValue) / (centroid.mean - previousValue)) / double(mCount);
+				found = true;
+				break;
+			}
+
+			previousPosition = position;
+			previousValue = centroid.mean;
+			weightSoFar += centroid.weight;
+		}
+
+		if (!found)
+		{
+			const double lastPosition(static_cast<double>(mCount));
+			ret = (previousPosition + (lastPosition - previousPosition) * (x - previousValue) / (mMax - previousValue)) / lastPosition;
+		}
+	}
+
+	return ret;
+}
+
+
+size_t TDigest::centroidsCount() const
+{
+	compress();
+
+	return mCentroids.size();
+}
+
+
+std::vector<uint8_t> TDigest::serialize() const
+{
+	compress();
+
+	std::vector<uint8_t> ret(__tDigestMagic, __tDigestMagic + sizeof(__tDigestMagic));
+	ret.reserve(__tDigestHeaderSize + 2 * sizeof(double) * mCentroids.size());
+
+	__writeDouble(ret, mCompression);
+	__writeUint64(ret, mCount);
+	__writeDouble(ret, mMin);
+	__writeDouble(ret, mMax);
+	__writeUint64(ret, mCentroids.size());
+
+	for (const auto& centroid : mCentroids)
+	{
+		__writeDouble(ret, centroid.mean);
+		__writeDouble(ret, centroid.weight);
+	}
+
+	return ret;
+}
+
+
+TDigest TDigest::deserialize(std::vector<uint8_t> const& bytes)
+{
+	const auto invalid([](const char* reason) { return std::invalid_argument("Math::TDigest::deserialize(): " + std::string(reason) + "."); });
+
+	if (bytes.size() < __tDigestHeaderSize || !std::equal(__tDigestMagic, __tDigestMagic + sizeof(__tDigestMagic), bytes.begin()))
+	{
+		throw invalid("not a serialized digest");
+	}
+
+	uint8_t const* cursor(bytes.data() + sizeof(__tDigestMagic));
+
+	const double compression(__readDouble(cursor));
+	const uint64_t count(__readUint64(cursor + 8));
+	const double minVal(__readDouble(cursor + 16));
+	const double maxVal(__readDouble(cursor + 24));
+	const uint64_t nbCentroids(__readUint64(cursor + 32));
+
+	cursor += 40;
+
+	if (nbCentroids > (bytes.size() - __tDigestHeaderSize) / (2 * sizeof(double)) || bytes.size() != __tDigestHeaderSize + nbCentroids * 2 * sizeof(double))
+	{
+		throw invalid("unexpected size");
+	}
+
+	if (!(compression >= minCompression && compression <= maxCompression) || (count == 0) != (nbCentroids == 0) || (count > 0 && !(minVal <= maxVal)))
+	{
+		throw invalid("inconsistent header");
+	}
+
+	TDigest ret(compression);
+
+	ret.mCount = count;
+	ret.mMin = (count > 0) ? minVal : ret.mMin;
+	ret.mMax = (count > 0) ? maxVal : ret.mMax;
+	ret.mCentroids.reserve(size_t(nbCentroids));
+
+	double previousMean(minVal);
+	double totalWeight(0.0);
+
+	for (uint64_t i = 0; i < nbCentroids; ++i, cursor += 16)
+	{
+		const Centroid centroid{ __readDouble(cursor), __readDouble(cursor + 8) };
+
+		if (!(centroid.mean >= previousMean && centroid.mean <= maxVal && centroid.weight > 0.0 && std::isfinite(centroid.weight)))
+		{
+			throw invalid("inconsistent centroids");
+		}
+
+		ret.mCentroids.push_back(centroid);
+		previousMean = centroid.mean;
+		totalWeight += centroid.weight;
+	}
+
+	// Weights are integers, whose sum is exact as long as count is: the tolerance covers greater counts
+	if (!(std::abs(totalWeight - double(count)) <= double(count) * 1e-12))
+	{
+		throw invalid("centroid weights do not add up to the count");
+	}
+
+	return ret;
+}
+
+
+void TDigest::compress() const
+{
+	if (mBuffer.empty())
+	{
+		return;
+	}
+
+	mBuffer.insert(mBuffer.end(), mCentroids.begin(), mCentroids.end());
+	std::sort(mBuffer.begin(), mBuffer.end(), [](Centroid const& a, Centroid const& b) { return a.mean < b.mean; });
+
+	double total(0.0);
+
+	for (const auto& centroid : mBuffer)
+	{
+		total += centroid.weight;
+	}
+
+	mCentroids.clear();
+
+	Centroid current(mBuffer.front());
+	double weightSoFar(0.0);
+	double weightLimit(total * __qOfK(__kOfQ(0.0, mCompression) + 1.0, mCompression));
+
+	for (size_t i = 1; i < mBuffer.size(); ++i)
+	{
+		const Centroid& next(mBuffer[i]);
+		const double proposedWeight(current.weight + next.weight);
+
+		if (weightSoFar + proposedWeight <= weightLimit)
+		{
+			current.mean += (next.mean - current.mean) * next.weight / proposedWeight;
+			current.weight = proposedWeight;
+		}
+		else
+		{
+			weightSoFar += current.weight;
+			weightLimit = total * __qOfK(__kOfQ(weightSoFar / total, mCompression) + 1.0, mCompression);
+
+			mCentroids.push_back(current);
+			current = next;
+		}
+	}
+
+	mCentroids.push_back(current);
+	mBuffer.clear();
+}
+
+}
+
+}
@@ -0,0 +1,490 @@
+#include <shlublu/random/QuasiRandom.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include <shlublu/random/Random.h>
+#include <shlublu/text/String.h>
+
+
+namespace shlublu
+{
+
+/// @cond INTERNAL
+
+namespace
+{
+	// Joe & Kuo (2008) primitive polynomials and initial direction numbers for dimensions 2 to 21.
+	// The first dimension is the van der Corput sequence in base 2 and needs no entry.
+	struct SobolInitializer
+	{
+		unsigned degree;
+		uint32_t coefficients;
+		uint32_t m[7];
+	};
+
+	const SobolInitializer __sobolInitializers[] =
+	{
+		{ 1, 0,  { 1 } },
+		{ 2, 1,  { 1, 3 } },
+		{ 3, 1,  { 1, 3, 1 } },
+		{ 3, 2,  { 1, 1, 1 } },
+		{ 4, 1,  { 1, 1, 3, 3 } },
+		{ 4, 4,  { 1, 3, 5, 13 } },
+		{ 5, 2,  { 1, 1, 5, 5, 17 } },
+		{ 5, 4,  { 1, 1, 5, 5, 5 } },
+		{ 5, 7,  { 1, 1, 7, 11, 19 } },
+		{ 5, 11, { 1, 1, 5, 1, 1 } },
+		{ 5, 13, { 1, 1, 1, 3, 11 } },
+		{ 5, 14, { 1, 3, 5, 5, 31 } },
+		{ 6, 1,  { 1, 3, 3, 9, 7, 49 } },
+		{ 6, 13, { 1, 1, 1, 15, 21, 21 } },
+		{ 6, 16, { 1, 3, 1, 13, 27, 49 } },
+		{ 6, 19, { 1, 1, 1, 15, 7, 5 } },
+		{ 6, 22, { 1, 3, 1, 15, 13, 25 } },
+		{ 6, 25, { 1, 1, 5, 5, 19, 61 } },
+		{ 7, 1,  { 1, 3, 7, 11, 23, 15, 103 } },
+		{ 7, 4,  { 1, 3, 7, 13, 13, 15, 69 } }
+	};
+
+	constexpr unsigned __sobolBits = 32;
+
+
+	unsigned __trailingZeros(size_t x)
+	{
+		unsigned ret(0);
+
+		while (!(x & 1) && ret < std::numeric_limits<size_t>::digits)
+		{
+			x >>= 1;
+			++ret;
+		}
+
+		return ret;
+	}
+
+
+	uint64_t __mix64(uint64_t x)
+	{
+		// SplitMix64 finalizer
+		x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+		x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+
+		return x ^ (x >> 31);
+	}
+
+
+	uint32_t __owenScramble(uint32_t value, uint64_t seed)
+	{
+		// Each bit is flipped depending on a hash of the bits that precede it, which is nested uniform scrambling.
+		uint32_t flips(0);
+
+		for (unsigned depth = 0; depth < __sobolBits; ++depth)
+		{
+			const uint64_t prefix(depth ? (value >> (__sobolBits - depth)) : 0);
+			const uint64_t flip(__mix64(seed ^ ((uint64_t(depth) << 32) | prefix)) >> 63);
+
+			flips |= static_cast<uint32_t>(flip << (__sobolBits - 1 - depth));
+		}
+
+		return value ^ flips;
+	}
+
+
+	double __fixedToUnit(uint64_t value)
+	{
+		return static_cast<double>(value >> 11) * 0x1.0p-53;
+	}
+}
+
+/// @endcond
+
+
+QuasiRandomSequence::QuasiRandomSequence(size_t dimensions)
+	: mDimensions(dimensions),
+	  mIndex(0),
+	  mPoint()
+{
+	if (!mDimensions)
+	{
+		throw std::invalid_argument("QuasiRandomSequence::QuasiRandomSequence(): dimensions should be strictly positive.");
+	}
+}
+
+
+QuasiRandomSequence::~QuasiRandomSequence()
+{}
+
+
+size_t QuasiRandomSequence::dimensions() const
+{
+	return mDimensions;
+}
+
+
+size_t QuasiRandomSequence::index() const
+{
+	return mIndex;
+}
+
+
+std::vector<double> const& QuasiRandomSequence::point() const
+{
+	return mPoint;
+}
+
+
+bool QuasiRandomSequence::next()
+{
+	const bool ret(mIndex < size());
+
+	if (ret)
+	{
+		mPoint.resize(mDimensions);
+
+		computeNextPoints(mPoint.data(), 1);
+		mIndex++;
+	}
+
+	return ret;
+}
+
+
+void QuasiRandomSequence::seek(size_t index)
+{
+	if (index > size())
+	{
+		throw std::out_of_range("QuasiRandomSequence::seek(): index (" + String::xtos(index) + ") > size (" + String::xtos(size()) + ")");
+	}
+
+	seekState(index);
+	mIndex = index;
+}
+
+
+void QuasiRandomSequence::skip(size_t count)
+{
+	if (count > size() - mIndex)
+	{
+		throw std::out_of_range("QuasiRandomSequence::skip(): skipping " + String::xtos(count) + " points from index " + String::xtos(mIndex) + " exceeds size (" + String::xtos(size()) + ")");
+	}
+
+	seek(mIndex + count);
+}
+
+
+size_t QuasiRandomSequence::generate(double* dest, size_t count)
+{
+	const size_t ret(std::min(count, size() - mIndex));
+
+	computeNextPoints(dest, ret);
+	mIndex += ret;
+
+	return ret;
+}
+
+
+std::vector<double> QuasiRandomSequence::generate(size_t count)
+{
+	std::vector<double> ret(std::min(count, size() - mIndex) * mDimensions);
+
+	generate(ret.data(), count);
+
+	return ret;
+}
+
+
+void QuasiRandomSequence::computeNextPoints(double* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		computePoint(mIndex + i, dest + i * mDimensions);
+	}
+}
+
+
+void QuasiRandomSequence::seekState(size_t)
+{}
+
+
+SobolSequence::SobolSequence(size_t dimensions, bool scrambled)
+	: QuasiRandomSequence(dimensions),
+	  mDirections(__sobolBits * dimensions, 0),
+	  mState(dimensions, 0),
+	  mSeeds()
+{
+	if (mDimensions > maxDimensions)
+	{
+		throw std::invalid_argument("SobolSequence::SobolSequence(): dimensions (" + String::xtos(mDimensions) + ") > " + String::xtos(maxDimensions));
+	}
+
+	for (unsigned bit = 0; bit < __sobolBits; ++bit)
+	{
+		mDirections[bit * mDimensions] = uint32_t(1) << (__sobolBits - 1 - bit);
+	}
+
+	for (size_t d = 1; d < mDimensions; ++d)
+	{
+		const SobolInitializer& init(__sobolInitializers[d - 1]);
+		const auto v([this, d](unsigned bit) -> uint32_t& { return mDirections[bit * mDimensions + d]; });
+
+		for (unsigned bit = 0; bit < __sobolBits; ++bit)
+		{
+			if (bit < init.degree)
+			{
+				v(bit) = init.m[bit] << (__sobolBits - 1 - bit);
+			}
+			else
+			{
+				v(bit) = v(bit - init.degree) ^ (v(bit - init.degree) >> init.degree);
+
+				for (unsigned i = 1; i < init.degree; ++i)
+				{
+					if ((init.coefficients >> (init.degree - 1 - i)) & 1)
+					{
+						v(bit) ^= v(bit - i);
+					}
+				}
+			}
+		}
+	}
+
+	if (scrambled)
+	{
+		mSeeds.resize(mDimensions);
+		std::generate(mSeeds.begin(), mSeeds.end(), []() { return (*Random::__sRandomEngine)(); });
+	}
+}
+
+
+SobolSequence::~SobolSequence()
+{}
+
+
+size_t SobolSequence::size() const
+{
+	return (sizeof(size_t) > sizeof(uint32_t)) ? static_cast<size_t>(uint64_t(1) << __sobolBits) : std::numeric_limits<size_t>::max();
+}
+
+
+void SobolSequence::computePoint(size_t index, double* dest) const
+{
+	const size_t gray(index ^ (index >> 1));
+
+	for (size_t d = 0; d < mDimensions; ++d)
+	{
+		uint32_t value(0);
+
+		for (unsigned bit = 0; bit < __sobolBits; ++bit)
+		{
+			if ((gray >> bit) & 1)
+			{
+				value ^= mDirections[bit * mDimensions + d];
+			}
+		}
+
+		dest[d] = toUnit(d, value);
+	}
+}
+
+
+void SobolSequence::computeNextPoints(double* dest, size_t count)
+{
+	// Antonov-Saleev: consecutive points differ by a single direction number, so the state update is a contiguous XOR over all dimensions.
+	for (size_t i = 0; i < count; ++i)
+	{
+		double* const row(dest + i * mDimensions);
+
+		for (size_t d = 0; d < mDimensions; ++d)
+		{
+			row[d] = toUnit(d, mState[d]);
+		}
+
+		const size_t nextIndex(mIndex + i + 1);
+
+		if (nextIndex < size())
+		{
+			const uint32_t* const directions(mDirections.data() + __trailingZeros(nextIndex) * mDimensions);
+
+			for (size_t d = 0; d < mDimensions; ++d)
+			{
+				mState[d] ^= directions[d];
+			}
+		}
+	}
+}
+
+
+void SobolSequence::seekState(size_t index)
+{
+	const size_t gray(index ^ (index >> 1));
+
+	std::fill(mState.begin(), mState.end(), 0);
+
+	for (unsigned bit = 0; bit < __sobolBits; ++bit)
+	{
+		if ((gray >> bit) & 1)
+		{
+			for (size_t d = 0; d < mDimensions; ++d)
+			{
+				mState[d] ^= mDirections[bit * mDimensions + d];
+			}
+		}
+	}
+}
+
+
+double SobolSequence::toUnit(size_t dimension, uint32_t value) const
+{
+	return static_cast<double>(mSeeds.empty() ? value : __owenScramble(value, mSeeds[dimension])) * 0x1.0p-32;
+}
+
+
+HaltonSequence::HaltonSequence(size_t dimensions, bool scrambled)
+	: QuasiRandomSequence(dimensions),
+	  mBases(),
+	  mPermutations()
+{
+	mBases.reserve(mDimensions);
+
+	for (uint32_t candidate = 2; mBases.size() < mDimensions; ++candidate)
+	{
+		if (std::none_of(mBases.begin(), mBases.end(), [candidate](uint32_t p) { return candidate % p == 0; }))
+		{
+			mBases.push_back(candidate);
+		}
+	}
+
+	if (scrambled)
+	{
+		for (const auto base : mBases)
+		{
+			std::vector<uint32_t> permutation(base);
+
+			std::iota(permutation.begin(), permutation.end(), 0);
+			std::shuffle(permutation.begin(), permutation.end(), *Random::__sRandomEngine);
+
+			mPermutations.push_back(std::move(permutation));
+		}
+	}
+}
+
+
+HaltonSequence::~HaltonSequence()
+{}
+
+
+size_t HaltonSequence::size() const
+{
+	return std::numeric_limits<size_t>::max();
+}
+
+
+void HaltonSequence::computePoint(size_t index, double* dest) const
+{
+	for (size_t d = 0; d < mDimensions; ++d)
+	{
+		const uint32_t base(mBases[d]);
+		const double invBase(1.0 / base);
+		const uint32_t* const permutation(mPermutations.empty() ? nullptr : mPermutations[d].data());
+
+		double factor(invBase);
+		double value(0.0);
+
+		for (size_t i = index; i > 0; i /= base)
+		{
+			const uint32_t digit(static_cast<uint32_t>(i % base));
+
+			value += (permutation ? permutation[digit] : digit) * factor;
+			factor *= invBase;
+		}
+
+		if (permutation)
+		{
+			// Leading zeros are permuted as well: this adds a geometric series to the value.
+			value += permutation[0] * factor / (1.0 - invBase);
+			value = std::min(value, 1.0 - std::numeric_limits<double>::epsilon() / 2.0);
+		}
+
+		dest[d] = value;
+	}
+}
+
+
+R2Sequence::R2Sequence(size_t dimensions, bool scrambled)
+	: QuasiRandomSequence(dimensions),
+	  mAlphas(dimensions),
+	  mOffsets(dimensions, uint64_t(1) << 63),
+	  mState()
+{
+	// phi is the unique positive root of x^(d + 1) = x + 1
+	long double phi(1.0L);
+
+	for (unsigned i = 0; i < 64; ++i)
+	{
+		phi = std::pow(1.0L + phi, 1.0L / static_cast<long double>(mDimensions + 1));
+	}
+
+	long double alpha(1.0L);
+
+	for (size_t d = 0; d < mDimensions; ++d)
+	{
+		alpha /= phi;
+		mAlphas[d] = static_cast<uint64_t>(std::ldexp(alpha, 64));
+	}
+
+	if (scrambled)
+	{
+		std::generate(mOffsets.begin(), mOffsets.end(), []() { return (*Random::__sRandomEngine)(); });
+	}
+
+	mState = mOffsets;
+}
+
+
+R2Sequence::~R2Sequence()
+{}
+
+
+size_t R2Sequence::size() const
+{
+	return std::numeric_limits<size_t>::max();
+}
+
+
+void R2Sequence::computePoint(size_t index, double* dest) const
+{
+	for (size_t d = 0; d < mDimensions; ++d)
+	{
+		dest[d] = __fixedToUnit(mOffsets[d] + static_cast<uint64_t>(index) * mAlphas[d]);
+	}
+}
+
+
+void R2Sequence::computeNextPoints(double* dest, size_t count)
+{
+	for (size_t i = 0; i < count; ++i)
+	{
+		double* const row(dest + i * mDimensions);
+
+		for (size_t d = 0; d < mDimensions; ++d)
+		{
+			row[d] = __fixedToUnit(mState[d]);
+			mState[d] += mAlphas[d];
+		}
+	}
+}
+
+
+void R2Sequence::seekState(size_t index)
+{
+	for (size_t d = 0; d < mDimensions; ++d)
+	{
+		mState[d] = mOffsets[d] + static_cast<uint64_t>(index) * mAlphas[d];
+	}
+}
+
+}
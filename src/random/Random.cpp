@@ -1,49 +1,115 @@
-#include <shlublu/random/Random.h>
-
-#ifndef _WIN32
-#pragma GCC diagnostic ignored "-Wunused-variable"
-#endif
-
-namespace shlublu
-{
-
-namespace Random
-{
-
-Engine* __sRandomEngine = nullptr;
-
-
-static void __randomEngineCleanup()
-{
-	if (Random::__sRandomEngine)
-	{
-		delete __sRandomEngine;
-		Random::__sRandomEngine = nullptr;
-	}
-}
-
-
-static bool __initRandom()
-{
-	__randomEngineCleanup();
-
-	std::random_device rd;
-	__sRandomEngine = new Engine(rd());
-
-	std::atexit(__randomEngineCleanup);
-
-	return true;
-}
-
-
-static bool __RandomInitialized(__initRandom());
-
-
-bool tossACoin()
-{
-	return probability(0.5);
-}
-
-}
-
-}
+#include <shlublu/random/Random.h>
+
+#include <cstdint>
+#include <cstring>
+
+#ifndef _WIN32
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#endif
+
+namespace shlublu
+{
+
+namespace Random
+{
+
+Engine* __sRandomEngine = nullptr;
+
+
+static void __randomEngineCleanup()
+{
+	if (Random::__sRandomEngine)
+	{
+		delete __sRandomEngine;
+		Random::__sRandomEngine = nullptr;
+	}
+}
+
+
+static bool __initRandom()
+{
+	__randomEngineCleanup();
+
+	std::random_device rd;
+	__sRandomEngine = new Engine(rd());
+
+	std::atexit(__randomEngineCleanup);
+
+	return true;
+}
+
+
+static bool __RandomInitialized(__initRandom());
+
+
+bool tossACoin()
+{
+	return probability(0.5);
+}
+
+
+void fillBytes(void* dest, size_t size)
+{
+	uint8_t* bytes(static_cast<uint8_t*>(dest));
+
+	static_assert(sizeof(Engine::result_type) == sizeof(uint64_t), "Engine should produce 64-bit values.");
+
+	for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t))
+	{
+		const uint64_t value((*__sRandomEngine)());
+		std::memcpy(bytes, &value, sizeof(uint64_t));
+	}
+
+	if (size)
+	{
+		const uint64_t value((*__sRandomEngine)());
+		std::memcpy(bytes, &value, size);
+	}
+}
+
+
+std::string randomString(size_t length, std::string const& alphabet)
+{
+	if (alphabet.empty())
+	{
+		throw std::invalid_argument("Random::randomString(): alphabet is empty.");
+	}
+
+	std::string ret(length, alphabet.front());
+
+	if (alphabet.size() > 1)
+	{
+		unsigned bits(0);
+
+		while ((size_t(1) << bits) < alphabet.size())
+		{
+			++bits;
+		}
+
+		const uint64_t mask((uint64_t(1) << bits) - 1);
+		const unsigned chunksPerDraw(64 / bits);
+
+		size_t pos(0);
+
+		while (pos < length)
+		{
+			uint64_t value((*__sRandomEngine)());
+
+			for (unsigned chunk = 0; chunk < chunksPerDraw && pos < length; ++chunk, value >>= bits)
+			{
+				const size_t index(static_cast<size_t>(value & mask));
+
+				if (index < alphabet.size())
+				{
+					ret[pos++] = alphabet[index];
+				}
+			}
+		}
+	}
+
+	return ret;
+}
+
+}
+
+}
@@ -0,0 +1,145 @@
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <shlublu/math/BigUnsigned.h>
+#include <shlublu/math/Combinatorics.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_BigUnsigned
+{
+	TEST_CLASS(BigUnsignedTest)
+	{
+	public:
+		TEST_METHOD(BigUnsignedConstructionIsCorrect)
+		{
+			Assert::IsTrue(BigUnsigned().isZero());
+			Assert::AreEqual(std::string("0"), BigUnsigned().toString());
+			Assert::AreEqual(std::string("18446744073709551615"), BigUnsigned(UINT64_MAX).toString());
+			Assert::AreEqual(uint64_t(1234567890123ULL), BigUnsigned(1234567890123ULL).toUint64());
+
+			const std::string big("123456789012345678901234567890123456789012345678901234567890");
+			Assert::AreEqual(big, BigUnsigned(big).toString());
+			Assert::AreEqual(std::string("1000000000"), BigUnsigned("0001000000000").toString());
+		}
+
+
+		TEST_METHOD(BigUnsignedConstructionThrowsIfNotDecimal)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { BigUnsigned(""); });
+			Assert::ExpectException<std::invalid_argument>([]() { BigUnsigned("12a"); });
+			Assert::ExpectException<std::invalid_argument>([]() { BigUnsigned("-12"); });
+		}
+
+
+		TEST_METHOD(BigUnsignedArithmeticIsCorrect)
+		{
+			const BigUnsigned a("340282366920938463463374607431768211455"); // 2^128 - 1
+			const BigUnsigned one(1);
+
+			Assert::AreEqual(std::string("340282366920938463463374607431768211456"), (a + one).toString());
+			Assert::AreEqual(std::string("340282366920938463463374607431768211454"), (a - one).toString());
+			Assert::AreEqual(std::string("115792089237316195423570985008687907852589419931798687112530834793049593217025"), (a * a).toString());
+			Assert::IsTrue((a + one) - one == a);
+			Assert::AreEqual(size_t(128), a.bits());
+
+			BigUnsigned x(a);
+			Assert::AreEqual(uint32_t(5), x.divideBy(10));
+			Assert::AreEqual(std::string("34028236692093846346337460743176821145"), x.toString());
+
+			x += x;
+			Assert::AreEqual(std::string("68056473384187692692674921486353642290"), x.toString());
+		}
+
+
+		TEST_METHOD(BigUnsignedKaratsubaMatchesSchoolbook)
+		{
+			// (10^k - 1)^2 = 10^2k - 2 * 10^k + 1 has a simple decimal representation
+			for (size_t digits : { 50, 500, 2000, 5000 })
+			{
+				const BigUnsigned x(std::string(digits, '9'));
+				const std::string expected(std::string(digits - 1, '9') + "8" + std::string(digits - 1, '0') + "1");
+
+				Assert::AreEqual(expected, (x * x).toString());
+			}
+		}
+
+
+		TEST_METHOD(BigUnsignedComparesProperly)
+		{
+			const BigUnsigned small(42);
+			const BigUnsigned large("100000000000000000000000");
+
+			Assert::IsTrue(small < large);
+			Assert::IsTrue(large > small);
+			Assert::IsTrue(small <= small);
+			Assert::IsTrue(small != large);
+			Assert::IsTrue(BigUnsigned(42) == small);
+		}
+
+
+		TEST_METHOD(BigUnsignedThrowsOnInvalidOperations)
+		{
+			Assert::ExpectException<std::domain_error>([]() { BigUnsigned(1) - BigUnsigned(2); });
+			Assert::ExpectException<std::domain_error>([]() { BigUnsigned(1).divideBy(0); });
+			Assert::ExpectException<std::overflow_error>([]() { BigUnsigned("18446744073709551616").toUint64(); });
+		}
+
+
+		TEST_METHOD(BigUnsignedMoveLeavesZero)
+		{
+			BigUnsigned source(std::string(100, '7'));
+			const BigUnsigned target(std::move(source));
+
+			Assert::AreEqual(std::string(100, '7'), target.toString());
+			Assert::IsTrue(source.isZero());
+		}
+	};
+
+
+	TEST_CLASS(ExactCountsTest)
+	{
+	public:
+		TEST_METHOD(FactorialIsExact)
+		{
+			Assert::AreEqual(std::string("2432902008176640000"), Math::factorial(BigUnsigned(20)).toString());
+			Assert::AreEqual(std::string("51090942171709440000"), Math::factorial(BigUnsigned(21)).toString());
+			Assert::AreEqual(std::string("93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000"), Math::factorial(BigUnsigned(100)).toString());
+
+			BigUnsigned expected(1);
+
+			for (size_t n = 1; n <= 1000; ++n)
+			{
+				expected *= BigUnsigned(n);
+			}
+
+			Assert::IsTrue(expected == Math::factorial(BigUnsigned(1000)));
+		}
+
+
+		TEST_METHOD(BinomialIsExact)
+		{
+			Assert::AreEqual(std::string("1613587787967350073386147640"), Math::binomial(BigUnsigned(200), BigUnsigned(20)).toString());
+			Assert::AreEqual(std::string("28453041475240576740"), Math::binomial(BigUnsigned(68), BigUnsigned(34)).toString());
+			Assert::IsTrue(Math::binomial(BigUnsigned(5), BigUnsigned(6)).isZero());
+
+			for (size_t k = 0; k <= 30; ++k)
+			{
+				Assert::AreEqual(Math::binomial(size_t(30), k), Math::binomial(BigUnsigned(30), BigUnsigned(k)).toUint64());
+			}
+		}
+
+
+		TEST_METHOD(CombinatoricsNumbersAreExact)
+		{
+			Assert::AreEqual(std::string("1613587787967350073386147640"), Combination::number<BigUnsigned>(200, 20).toString());
+			Assert::AreEqual(std::string("3925700969715068378846658669703390239129600000"), Arrangement::number<BigUnsigned>(200, 20).toString());
+			Assert::AreEqual(Arrangement::number(30, 9), Arrangement::number<BigUnsigned>(30, 9).toUint64());
+		}
+	};
+}
@@ -1,177 +1,995 @@
-#define NOMINMAX
-
-#include "CppUnitTest.h"
-
-#include <shlublu/math/Combinatorics.h>
-#include <shlublu/util/Debug.h>
-SHLUBLU_OPTIMIZE_OFF();
-
-
-using namespace Microsoft::VisualStudio::CppUnitTestFramework;
-using namespace shlublu;
-
-namespace math_Combinatorics
-{
-	TEST_CLASS(CombinationsTest)
-	{
-	public:
-		TEST_METHOD(CombinationsConstructionIsCorrect)
-		{
-			constexpr size_t n(5);
-			constexpr size_t k(3);
-
-			const Combination combi(n, k);
-
-			Assert::AreEqual(n, combi.n());
-			Assert::AreEqual(k, combi.k());
-		}
-
-
-		TEST_METHOD(CombinationsConstructionThrowsIfKGreaterThanN)
-		{
-			Assert::ExpectException<std::invalid_argument>([]() { return Combination(5, 6).number(); });
-		}
-
-
-		TEST_METHOD(CombinationsHasTheProperNumber)
-		{
-			Assert::AreEqual(size_t(924), Combination(12, 6).number());
-			Assert::AreEqual(size_t(5), Combination(5, 4).number());
-			
-			Assert::AreEqual(size_t(1), Combination(8, 8).number());
-
-			const Combination combi(14, 1);
-			Assert::AreEqual(size_t(combi.n()), combi.number());
-		}
-
-
-		TEST_METHOD(CombinationsHasTheProperStaticNumber)
-		{
-			Assert::AreEqual(size_t(924), Combination::number(12, 6));
-			Assert::AreEqual(size_t(5), Combination::number(5, 4));
-
-			Assert::AreEqual(size_t(1), Combination::number(8, 8));
-			Assert::AreEqual(size_t(14), Combination::number(14, 1));
-		}
-
-
-		TEST_METHOD(CombinationsRollsAsExepected)
-		{
-			Combination combi(12, 6);
-
-			size_t ctr(0);
-			while (combi.next())
-			{
-				ctr++;
-			}
-
-			Assert::AreEqual(combi.number(), ctr);
-		}
-
-		TEST_METHOD(CombinationsIsComplete)
-		{
-			Combination combi(5, 4);
-
-			Assert::IsTrue(combi.next());
-			Assert::IsTrue(std::vector<size_t>{ {0, 1, 2, 3} } == combi.kUplet());
-
-			Assert::IsTrue(combi.next());
-			Assert::IsTrue(std::vector<size_t>{ {0, 1, 2, 4} } == combi.kUplet());
-
-			Assert::IsTrue(combi.next());
-			Assert::IsTrue(std::vector<size_t>{ {0, 1, 3, 4} } == combi.kUplet());
-
-			Assert::IsTrue(combi.next());
-			Assert::IsTrue(std::vector<size_t>{ {0, 2, 3, 4} } == combi.kUplet());
-
-			Assert::IsTrue(combi.next());
-			Assert::IsTrue(std::vector<size_t>{ {1, 2, 3, 4} } == combi.kUplet());
-
-			Assert::IsFalse(combi.next());
-		}
-	};
-
-
-	TEST_CLASS(ArrangementsTest)
-	{
-	public:
-		TEST_METHOD(ArrangementsConstructionIsCorrect)
-		{
-			constexpr size_t n(5);
-			constexpr size_t k(3);
-
-			const Arrangement argt(n, k);
-
-			Assert::AreEqual(n, argt.n());
-			Assert::AreEqual(k, argt.k());
-		}
-
-
-		TEST_METHOD(ArrangementsConstructionThrowsIfKGreaterThanN)
-		{
-			Assert::ExpectException<std::logic_error>([]() { return Arrangement(5, 6).number(); });
-		}
-
-
-		TEST_METHOD(ArrangementsHasTheProperNumber)
-		{
-			Assert::AreEqual(size_t(665280), Arrangement(12, 6).number());
-			Assert::AreEqual(size_t(6), Arrangement(3, 2).number());
-
-			Assert::AreEqual(size_t(40320), Arrangement(8, 8).number());
-
-			const Arrangement combi(14, 1);
-			Assert::AreEqual(size_t(combi.n()), combi.number());
-		}
-
-
-		TEST_METHOD(ArrangementsHasTheProperStaticNumber)
-		{
-			Assert::AreEqual(size_t(665280), Arrangement::number(12, 6));
-			Assert::AreEqual(size_t(6), Arrangement::number(3, 2));
-
-			Assert::AreEqual(size_t(40320), Arrangement::number(8, 8));
-			Assert::AreEqual(size_t(14), Arrangement::number(14, 1));
-		}
-
-		
-		TEST_METHOD(ArrangementsRollsAsExepected)
-		{
-			Arrangement argts(12, 6);
-
-			size_t ctr(0);
-			while (argts.next())
-			{
-				ctr++;
-			}
-
-			Assert::AreEqual(argts.number(), ctr);
-		}
-
-
-		TEST_METHOD(ArrangementsIsComplete)
-		{
-			Arrangement argt(3, 2);
-
-			Assert::IsTrue(argt.next());
-			Assert::IsTrue(std::vector<size_t>{ {0, 1} } == argt.kUplet());
-
-			Assert::IsTrue(argt.next());
-			Assert::IsTrue(std::vector<size_t>{ {1, 0} } == argt.kUplet());
-
-			Assert::IsTrue(argt.next());
-			Assert::IsTrue(std::vector<size_t>{ {0, 2} } == argt.kUplet());
-
-			Assert::IsTrue(argt.next());
-			Assert::IsTrue(std::vector<size_t>{ {2, 0} } == argt.kUplet());
-
-			Assert::IsTrue(argt.next());
-			Assert::IsTrue(std::vector<size_t>{ {1, 2} } == argt.kUplet());
-
-			Assert::IsTrue(argt.next());
-			Assert::IsTrue(std::vector<size_t>{ {2, 1} } == argt.kUplet());
-
-			Assert::IsFalse(argt.next());
-		}
-	};
-}
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <set>
+
+#include <shlublu/math/Combinatorics.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_Combinatorics
+{
+	TEST_CLASS(CombinationsTest)
+	{
+	public:
+		TEST_METHOD(CombinationsConstructionIsCorrect)
+		{
+			constexpr size_t n(5);
+			constexpr size_t k(3);
+
+			const Combination combi(n, k);
+
+			Assert::AreEqual(n, combi.n());
+			Assert::AreEqual(k, combi.k());
+		}
+
+
+		TEST_METHOD(CombinationsConstructionThrowsIfKGreaterThanN)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { return Combination(5, 6).number(); });
+		}
+
+
+		TEST_METHOD(CombinationsHasTheProperNumber)
+		{
+			Assert::AreEqual(size_t(924), Combination(12, 6).number());
+			Assert::AreEqual(size_t(5), Combination(5, 4).number());
+			
+			Assert::AreEqual(size_t(1), Combination(8, 8).number());
+
+			const Combination combi(14, 1);
+			Assert::AreEqual(size_t(combi.n()), combi.number());
+		}
+
+
+		TEST_METHOD(CombinationsHasTheProperStaticNumber)
+		{
+			Assert::AreEqual(size_t(924), Combination::number(12, 6));
+			Assert::AreEqual(size_t(5), Combination::number(5, 4));
+
+			Assert::AreEqual(size_t(1), Combination::number(8, 8));
+			Assert::AreEqual(size_t(14), Combination::number(14, 1));
+		}
+
+
+		TEST_METHOD(CombinationsRollsAsExepected)
+		{
+			Combination combi(12, 6);
+
+			size_t ctr(0);
+			while (combi.next())
+			{
+				ctr++;
+			}
+
+			Assert::AreEqual(combi.number(), ctr);
+		}
+
+		TEST_METHOD(CombinationsIsComplete)
+		{
+			Combination combi(5, 4);
+
+			Assert::IsTrue(combi.next());
+			Assert::IsTrue(std::vector<size_t>{ {0, 1, 2, 3} } == combi.kUplet());
+
+			Assert::IsTrue(combi.next());
+			Assert::IsTrue(std::vector<size_t>{ {0, 1, 2, 4} } == combi.kUplet());
+
+			Assert::IsTrue(combi.next());
+			Assert::IsTrue(std::vector<size_t>{ {0, 1, 3, 4} } == combi.kUplet());
+
+			Assert::IsTrue(combi.next());
+			Assert::IsTrue(std::vector<size_t>{ {0, 2, 3, 4} } == combi.kUplet());
+
+			Assert::IsTrue(combi.next());
+			Assert::IsTrue(std::vector<size_t>{ {1, 2, 3, 4} } == combi.kUplet());
+
+			Assert::IsFalse(combi.next());
+		}
+
+
+		TEST_METHOD(CombinationsFollowsLexicographicOrder)
+		{
+			const std::vector<std::pair<size_t, size_t>> sizes({ { 1, 1 }, { 6, 6 }, { 7, 1 }, { 9, 4 }, { 12, 11 }, { 70, 3 } });
+
+			for (const auto& size : sizes)
+			{
+				Combination combi(size.first, size.second);
+
+				// Reference: the combination as a bitmask of K leading 1's and N-K trailing 0's, rolled in reverse order
+				std::string bitmask(size.second, 1);
+				bitmask.resize(size.first, 0);
+
+				do
+				{
+					std::vector<size_t> expected;
+
+					for (size_t i = 0; i < bitmask.size(); ++i)
+					{
+						if (bitmask[i])
+						{
+							expected.push_back(i);
+						}
+					}
+
+					Assert::IsTrue(combi.next());
+					Assert::IsTrue(expected == combi.kUplet());
+				} while (std::prev_permutation(bitmask.begin(), bitmask.end()));
+
+				Assert::IsFalse(combi.next());
+				Assert::IsFalse(combi.next());
+			}
+
+			Assert::IsFalse(Combination(5, 0).next());
+		}
+
+
+		TEST_METHOD(CombinationsRankUnrankAndSeekMatchEnumeration)
+		{
+			Combination combi(9, 4);
+			Combination sought(9, 4);
+
+			for (size_t index = 0; combi.next(); ++index)
+			{
+				Assert::IsTrue(combi.kUplet() == combi.unrank(index));
+				Assert::AreEqual(index, combi.rank(combi.kUplet()));
+
+				sought.seek(index);
+
+				Assert::IsTrue(sought.next());
+				Assert::IsTrue(combi.kUplet() == sought.kUplet());
+
+				for (Combination copy(combi); copy.next(); )
+				{
+					Assert::IsTrue(sought.next());
+					Assert::IsTrue(copy.kUplet() == sought.kUplet());
+				}
+
+				Assert::IsFalse(sought.next());
+			}
+
+			Assert::IsTrue(std::vector<size_t>{ { 95, 96, 97, 98, 99 } } == Combination(100, 5).unrank(Combination::number(100, 5) - 1));
+			Assert::AreEqual(size_t(75287519), Combination(100, 5).rank({ 95, 96, 97, 98, 99 }));
+		}
+
+
+		TEST_METHOD(CombinationsNextBatchGivesNextKUplets)
+		{
+			Combination reference(10, 4);
+			Combination wide(10, 4);
+			Combination narrow(10, 4);
+
+			std::vector<size_t> wideBuffer(7 * reference.k());
+			std::vector<uint8_t> narrowBuffer(7 * reference.k());
+			size_t count(0);
+
+			while ((count = wide.nextBatch(wideBuffer.data(), 7)) > 0)
+			{
+				Assert::AreEqual(count, narrow.nextBatch(narrowBuffer.data(), 7));
+
+				for (size_t row = 0; row < count; ++row)
+				{
+					Assert::IsTrue(reference.next());
+
+					for (size_t i = 0; i < reference.k(); ++i)
+					{
+						Assert::AreEqual(reference.kUplet()[i], wideBuffer[row * reference.k() + i]);
+						Assert::AreEqual(reference.kUplet()[i], size_t(narrowBuffer[row * reference.k() + i]));
+					}
+				}
+			}
+
+			Assert::IsFalse(reference.next());
+			Assert::AreEqual(size_t(0), narrow.nextBatch(narrowBuffer.data(), 7));
+
+			uint8_t unused[3];
+			Assert::AreEqual(size_t(1), Combination(256, 3).nextBatch(unused, 1));
+			Assert::ExpectException<std::invalid_argument>([&unused]() { Combination(257, 3).nextBatch(unused, 1); });
+		}
+
+
+		TEST_METHOD(CombinationsParallelForEachVisitsEachKUpletOnce)
+		{
+			for (const size_t threads : { 1, 3, 8, 1000 })
+			{
+				const Combination combi(12, 5);
+				const auto seen(std::make_unique<std::atomic<size_t>[]>(combi.number()));
+
+				combi.parallelForEach(threads, [&combi, &seen](std::vector<size_t> const& kUplet) { ++seen[combi.rank(kUplet)]; });
+
+				for (size_t i = 0; i < combi.number(); ++i)
+				{
+					Assert::AreEqual(size_t(1), seen[i].load());
+				}
+			}
+
+			Assert::ExpectException<std::invalid_argument>([]() { Combination(5, 3).parallelForEach(0, [](std::vector<size_t> const&) {}); });
+			Assert::ExpectException<std::runtime_error>([]() { Combination(5, 3).parallelForEach(4, [](std::vector<size_t> const&) { throw std::runtime_error("callback"); }); });
+		}
+
+
+		TEST_METHOD(CombinationsRankUnrankAndSeekThrowAppropriately)
+		{
+			Combination combi(5, 3);
+
+			Assert::ExpectException<std::out_of_range>([&combi]() { combi.unrank(10); });
+			Assert::ExpectException<std::out_of_range>([&combi]() { combi.seek(10); });
+			Assert::ExpectException<std::invalid_argument>([&combi]() { combi.rank({ 0, 1 }); });
+			Assert::ExpectException<std::invalid_argument>([&combi]() { combi.rank({ 0, 2, 1 }); });
+			Assert::ExpectException<std::invalid_argument>([&combi]() { combi.rank({ 0, 1, 1 }); });
+			Assert::ExpectException<std::invalid_argument>([&combi]() { combi.rank({ 0, 1, 5 }); });
+		}
+	};
+
+
+	TEST_CLASS(ArrangementsTest)
+	{
+	public:
+		TEST_METHOD(ArrangementsConstructionIsCorrect)
+		{
+			constexpr size_t n(5);
+			constexpr size_t k(3);
+
+			const Arrangement argt(n, k);
+
+			Assert::AreEqual(n, argt.n());
+			Assert::AreEqual(k, argt.k());
+		}
+
+
+		TEST_METHOD(ArrangementsConstructionThrowsIfKGreaterThanN)
+		{
+			Assert::ExpectException<std::logic_error>([]() { return Arrangement(5, 6).number(); });
+		}
+
+
+		TEST_METHOD(ArrangementsHasTheProperNumber)
+		{
+			Assert::AreEqual(size_t(665280), Arrangement(12, 6).number());
+			Assert::AreEqual(size_t(6), Arrangement(3, 2).number());
+
+			Assert::AreEqual(size_t(40320), Arrangement(8, 8).number());
+
+			const Arrangement combi(14, 1);
+			Assert::AreEqual(size_t(combi.n()), combi.number());
+		}
+
+
+		TEST_METHOD(ArrangementsHasTheProperStaticNumber)
+		{
+			Assert::AreEqual(size_t(665280), Arrangement::number(12, 6));
+			Assert::AreEqual(size_t(6), Arrangement::number(3, 2));
+
+			Assert::AreEqual(size_t(40320), Arrangement::number(8, 8));
+			Assert::AreEqual(size_t(14), Arrangement::number(14, 1));
+		}
+
+		
+		TEST_METHOD(ArrangementsRollsAsExepected)
+		{
+			Arrangement argts(12, 6);
+
+			size_t ctr(0);
+			while (argts.next())
+			{
+				ctr++;
+			}
+
+			Assert::AreEqual(argts.number(), ctr);
+		}
+
+
+		TEST_METHOD(ArrangementsIsComplete)
+		{
+			Arrangement argt(3, 2);
+
+			Assert::IsTrue(argt.next());
+			Assert::IsTrue(std::vector<size_t>{ {0, 1} } == argt.kUplet());
+
+			Assert::IsTrue(argt.next());
+			Assert::IsTrue(std::vector<size_t>{ {1, 0} } == argt.kUplet());
+
+			Assert::IsTrue(argt.next());
+			Assert::IsTrue(std::vector<size_t>{ {0, 2} } == argt.kUplet());
+
+			Assert::IsTrue(argt.next());
+			Assert::IsTrue(std::vector<size_t>{ {2, 0} } == argt.kUplet());
+
+			Assert::IsTrue(argt.next());
+			Assert::IsTrue(std::vector<size_t>{ {1, 2} } == argt.kUplet());
+
+			Assert::IsTrue(argt.next());
+			Assert::IsTrue(std::vector<size_t>{ {2, 1} } == argt.kUplet());
+
+			Assert::IsFalse(argt.next());
+		}
+
+
+		TEST_METHOD(ArrangementsRankUnrankAndSeekMatchEnumeration)
+		{
+			Arrangement argt(7, 3);
+			Arrangement sought(7, 3);
+
+			for (size_t index = 0; argt.next(); ++index)
+			{
+				Assert::IsTrue(argt.kUplet() == argt.unrank(index));
+				Assert::AreEqual(index, argt.rank(argt.kUplet()));
+
+				sought.seek(index);
+
+				Assert::IsTrue(sought.next());
+				Assert::IsTrue(argt.kUplet() == sought.kUplet());
+
+				for (Arrangement copy(argt); copy.next(); )
+				{
+					Assert::IsTrue(sought.next());
+					Assert::IsTrue(copy.kUplet() == sought.kUplet());
+				}
+
+				Assert::IsFalse(sought.next());
+			}
+
+			Assert::IsTrue(std::vector<size_t>{ { 29, 28, 27, 26, 25, 24, 23, 22, 21 } } == Arrangement(30, 9).unrank(Arrangement::number(30, 9) - 1));
+		}
+
+
+		TEST_METHOD(ArrangementsNextBatchGivesNextKUplets)
+		{
+			Arrangement reference(6, 3);
+			Arrangement wide(6, 3);
+			Arrangement narrow(6, 3);
+
+			std::vector<size_t> wideBuffer(7 * reference.k());
+			std::vector<uint8_t> narrowBuffer(7 * reference.k());
+			size_t count(0);
+
+			while ((count = wide.nextBatch(wideBuffer.data(), 7)) > 0)
+			{
+				Assert::AreEqual(count, narrow.nextBatch(narrowBuffer.data(), 7));
+
+				for (size_t row = 0; row < count; ++row)
+				{
+					Assert::IsTrue(reference.next());
+
+					for (size_t i = 0; i < reference.k(); ++i)
+					{
+						Assert::AreEqual(reference.kUplet()[i], wideBuffer[row * reference.k() + i]);
+						Assert::AreEqual(reference.kUplet()[i], size_t(narrowBuffer[row * reference.k() + i]));
+					}
+				}
+			}
+
+			Assert::IsFalse(reference.next());
+			Assert::AreEqual(size_t(0), narrow.nextBatch(narrowBuffer.data(), 7));
+
+			uint8_t unused[3];
+			Assert::AreEqual(size_t(1), Arrangement(256, 3).nextBatch(unused, 1));
+			Assert::ExpectException<std::invalid_argument>([&unused]() { Arrangement(257, 3).nextBatch(unused, 1); });
+		}
+
+
+		TEST_METHOD(ArrangementsParallelForEachVisitsEachKUpletOnce)
+		{
+			for (const size_t threads : { 1, 3, 8, 1000 })
+			{
+				const Arrangement argt(8, 4);
+				const auto seen(std::make_unique<std::atomic<size_t>[]>(argt.number()));
+
+				argt.parallelForEach(threads, [&argt, &seen](std::vector<size_t> const& kUplet) { ++seen[argt.rank(kUplet)]; });
+
+				for (size_t i = 0; i < argt.number(); ++i)
+				{
+					Assert::AreEqual(size_t(1), seen[i].load());
+				}
+			}
+
+			Assert::ExpectException<std::invalid_argument>([]() { Arrangement(5, 3).parallelForEach(0, [](std::vector<size_t> const&) {}); });
+			Assert::ExpectException<std::runtime_error>([]() { Arrangement(5, 3).parallelForEach(4, [](std::vector<size_t> const&) { throw std::runtime_error("callback"); }); });
+		}
+
+
+		TEST_METHOD(ArrangementsRankUnrankAndSeekThrowAppropriately)
+		{
+			Arrangement argt(5, 3);
+
+			Assert::ExpectException<std::out_of_range>([&argt]() { argt.unrank(60); });
+			Assert::ExpectException<std::out_of_range>([&argt]() { argt.seek(60); });
+			Assert::ExpectException<std::invalid_argument>([&argt]() { argt.rank({ 0, 1 }); });
+			Assert::ExpectException<std::invalid_argument>([&argt]() { argt.rank({ 2, 0, 2 }); });
+			Assert::ExpectException<std::invalid_argument>([&argt]() { argt.rank({ 4, 5, 0 }); });
+		}
+	};
+
+
+	TEST_CLASS(PermutationsTest)
+	{
+	public:
+		TEST_METHOD(PermutationsAreCompleteAndDifferByOneSwap)
+		{
+			for (size_t n = 1; n <= 7; ++n)
+			{
+				Permutation perm(n);
+				std::vector<std::vector<size_t>> seen;
+
+				Assert::AreEqual(Math::factorial(n), perm.number());
+				Assert::IsTrue(perm.next());
+				Assert::IsTrue(std::make_pair(size_t(0), size_t(0)) == perm.swapped());
+
+				seen.push_back(perm.kUplet());
+
+				while (perm.next())
+				{
+					auto expected(seen.back());
+					std::swap(expected[perm.swapped().first], expected[perm.swapped().second]);
+
+					Assert::IsTrue(perm.swapped().first < perm.swapped().second);
+					Assert::IsTrue(expected == perm.kUplet());
+
+					seen.push_back(perm.kUplet());
+				}
+
+				Assert::IsFalse(perm.next());
+				Assert::AreEqual(perm.number(), seen.size());
+
+				std::sort(seen.begin(), seen.end());
+				Assert::IsTrue(std::adjacent_find(seen.begin(), seen.end()) == seen.end());
+			}
+
+			Assert::IsFalse(Permutation(0).next());
+		}
+
+
+		TEST_METHOD(PermutationsNextBatchGivesNextKUplets)
+		{
+			Permutation reference(5);
+			Permutation batched(5);
+			uint8_t buffer[5 * 50];
+			size_t count(0);
+
+			while ((count = batched.nextBatch(buffer, 50)) > 0)
+			{
+				for (size_t row = 0; row < count; ++row)
+				{
+					Assert::IsTrue(reference.next());
+					Assert::IsTrue(std::equal(reference.kUplet().begin(), reference.kUplet().end(), buffer + row * 5));
+				}
+			}
+
+			Assert::IsFalse(reference.next());
+		}
+	};
+
+
+	TEST_CLASS(MinimalChangesTest)
+	{
+	public:
+		TEST_METHOD(MinimalChangeCombinationsAreCompleteAndDifferByOneElement)
+		{
+			for (size_t n = 1; n <= 9; ++n)
+			{
+				for (size_t k = 1; k <= n; ++k)
+				{
+					MinimalChangeCombination combi(n, k);
+					std::vector<std::vector<size_t>> seen;
+
+					Assert::IsTrue(combi.next());
+					Assert::AreEqual(MinimalChangeCombination::none, combi.entered());
+					Assert::AreEqual(MinimalChangeCombination::none, combi.left());
+
+					seen.push_back(combi.kUplet());
+
+					while (combi.next())
+					{
+						auto expected(seen.back());
+
+						Assert::IsTrue(std::is_sorted(combi.kUplet().begin(), combi.kUplet().end()));
+						Assert::IsTrue(std::find(expected.begin(), expected.end(), combi.entered()) == expected.end());
+
+						*std::find(expected.begin(), expected.end(), combi.left()) = combi.entered();
+						std::sort(expected.begin(), expected.end());
+
+						Assert::IsTrue(expected == combi.kUplet());
+
+						seen.push_back(combi.kUplet());
+					}
+
+					Assert::IsFalse(combi.next());
+					Assert::AreEqual(combi.number(), seen.size());
+
+					std::sort(seen.begin(), seen.end());
+					Assert::IsTrue(std::adjacent_find(seen.begin(), seen.end()) == seen.end());
+				}
+			}
+
+			Assert::IsFalse(MinimalChangeCombination(4, 0).next());
+			Assert::ExpectException<std::invalid_argument>([]() { MinimalChangeCombination(4, 5); });
+		}
+
+
+		TEST_METHOD(SubsetsAreCompleteAndDifferByOneElement)
+		{
+			for (size_t n = 0; n <= 10; ++n)
+			{
+				Subset subset(n);
+				std::vector<std::vector<size_t>> seen;
+
+				Assert::IsTrue(subset.next());
+				Assert::IsTrue(subset.kUplet().empty());
+				Assert::AreEqual(Subset::none, subset.entered());
+				Assert::AreEqual(Subset::none, subset.left());
+
+				seen.push_back(subset.kUplet());
+
+				while (subset.next())
+				{
+					auto expected(seen.back());
+
+					if (subset.entered() != Subset::none)
+					{
+						Assert::AreEqual(Subset::none, subset.left());
+						Assert::IsTrue(std::find(expected.begin(), expected.end(), subset.entered()) == expected.end());
+
+						expected.push_back(subset.entered());
+					}
+					else
+					{
+						Assert::IsFalse(subset.contains(subset.left()));
+						expected.erase(std::find(expected.begin(), expected.end(), subset.left()));
+					}
+
+					auto current(subset.kUplet());
+
+					std::sort(expected.begin(), expected.end());
+					std::sort(current.begin(), current.end());
+
+					Assert::IsTrue(expected == current);
+
+					for (size_t element = 0; element < n; ++element)
+					{
+						Assert::AreEqual(std::binary_search(current.begin(), current.end(), element), subset.contains(element));
+					}
+
+					seen.push_back(current);
+				}
+
+				Assert::IsFalse(subset.next());
+				Assert::AreEqual(subset.number(), seen.size());
+
+				std::sort(seen.begin(), seen.end());
+				Assert::IsTrue(std::adjacent_find(seen.begin(), seen.end()) == seen.end());
+			}
+
+			Assert::ExpectException<std::overflow_error>([]() { Subset::number(std::numeric_limits<size_t>::digits); });
+		}
+	};
+
+
+	TEST_CLASS(MultisetsAndProductsTest)
+	{
+	public:
+		TEST_METHOD(MultisetCombinationsAreCorrect)
+		{
+			for (size_t n = 1; n <= 6; ++n)
+			{
+				for (size_t k = 1; k <= 7; ++k)
+				{
+					// [a0..aK-1] maps to the combination [a0+0..aK-1+K-1] of N+K-1 elements, which preserves the lexicographic order
+					MultisetCombination multisets(n, k);
+					Combination combinations(n + k - 1, k);
+
+					while (multisets.next())
+					{
+						Assert::IsTrue(combinations.next());
+
+						for (size_t i = 0; i < k; ++i)
+						{
+							Assert::AreEqual(combinations.kUplet()[i], multisets.kUplet()[i] + i);
+						}
+					}
+
+					Assert::IsFalse(combinations.next());
+					Assert::IsFalse(multisets.next());
+					Assert::AreEqual(combinations.number(), multisets.number());
+				}
+			}
+
+			Assert::IsFalse(MultisetCombination(0, 3).next());
+			Assert::IsFalse(MultisetCombination(3, 0).next());
+			Assert::AreEqual(size_t(0), MultisetCombination::number(0, 3));
+			Assert::AreEqual(size_t(1), MultisetCombination::number(0, 0));
+		}
+
+
+		TEST_METHOD(MultisetPermutationsAreCorrect)
+		{
+			for (const auto& multiplicities : std::vector<std::vector<size_t>>{ { 1 }, { 3 }, { 1, 1, 1, 1 }, { 2, 1 }, { 2, 0, 2 }, { 1, 3, 2 }, { 2, 2, 2, 1 } })
+			{
+				MultisetPermutation permutations(multiplicities);
+				std::vector<size_t> elements;
+
+				for (size_t element = 0; element < multiplicities.size(); ++element)
+				{
+					elements.insert(elements.end(), multiplicities[element], element);
+				}
+
+				// Reference: all the orderings of the positions, without duplicates, in lexicographic order
+				std::set<std::vector<size_t>> expected;
+				Permutation positions(elements.size());
+
+				while (positions.next())
+				{
+					std::vector<size_t> ordering;
+
+					for (const auto& position : positions.kUplet())
+					{
+						ordering.push_back(elements[position]);
+					}
+
+					expected.insert(ordering);
+				}
+
+				for (const auto& ordering : expected)
+				{
+					Assert::IsTrue(permutations.next());
+					Assert::IsTrue(ordering == permutations.kUplet());
+				}
+
+				Assert::IsFalse(permutations.next());
+				Assert::IsFalse(permutations.next());
+				Assert::AreEqual(expected.size(), permutations.number());
+				Assert::AreEqual(multiplicities.size(), permutations.n());
+			}
+
+			Assert::IsFalse(MultisetPermutation({}).next());
+			Assert::IsFalse(MultisetPermutation({ 0, 0 }).next());
+			Assert::AreEqual(size_t(3432), MultisetPermutation::number({ 7, 7 }));
+			Assert::ExpectException<std::overflow_error>([]() { MultisetPermutation::number(std::vector<size_t>(30, 1)); });
+		}
+
+
+		TEST_METHOD(CartesianProductsAreCorrect)
+		{
+			for (const auto& radices : std::vector<std::vector<size_t>>{ { 1 }, { 5 }, { 2, 3 }, { 3, 1, 4 }, { 2, 2, 2, 2, 2 }, { 1, 7, 1 } })
+			{
+				CartesianProduct product(radices);
+				size_t index(0);
+
+				while (product.next())
+				{
+					// Mixed-radix digits of the index, the last one being the least significant
+					size_t remaining(index);
+
+					for (size_t i = radices.size(); i > 0; --i)
+					{
+						Assert::AreEqual(remaining % radices[i - 1], product.kUplet()[i - 1]);
+						remaining /= radices[i - 1];
+					}
+
+					++index;
+				}
+
+				Assert::IsFalse(product.next());
+				Assert::AreEqual(product.number(), index);
+				Assert::AreEqual(*std::max_element(radices.begin(), radices.end()), product.n());
+			}
+
+			Assert::IsFalse(CartesianProduct({}).next());
+			Assert::IsFalse(CartesianProduct({ 3, 0, 2 }).next());
+			Assert::AreEqual(size_t(0), CartesianProduct::number({ 3, 0, 2 }));
+			Assert::ExpectException<std::overflow_error>([]() { CartesianProduct::number(std::vector<size_t>(65, 2)); });
+		}
+
+
+		TEST_METHOD(MultisetsAndProductsNextBatch)
+		{
+			MultisetCombination multisets(4, 6);
+			MultisetPermutation permutations({ 2, 1, 3 });
+			CartesianProduct product({ 3, 300, 2 });
+
+			for (EnumerativeCombinatorics* enumerator : std::vector<EnumerativeCombinatorics*>{ &multisets, &permutations })
+			{
+				std::vector<uint8_t> buffer(enumerator->number() * enumerator->k());
+
+				Assert::AreEqual(enumerator->number(), enumerator->nextBatch(buffer.data(), enumerator->number() + 1));
+				Assert::AreEqual(size_t(0), enumerator->nextBatch(buffer.data(), 1));
+			}
+
+			std::vector<size_t> buffer(7 * 3);
+			CartesianProduct reference({ 3, 300, 2 });
+
+			Assert::AreEqual(size_t(7), product.nextBatch(buffer.data(), 7));
+
+			for (size_t row = 0; row < 7; ++row)
+			{
+				Assert::IsTrue(reference.next());
+				Assert::IsTrue(std::equal(reference.kUplet().begin(), reference.kUplet().end(), buffer.begin() + row * 3));
+			}
+
+			std::vector<uint8_t> bytes(3);
+			Assert::ExpectException<std::invalid_argument>([&product, &bytes]() { product.nextBatch(bytes.data(), 1); });
+		}
+	};
+
+
+	TEST_CLASS(RandomKUpletsTest)
+	{
+	public:
+		TEST_METHOD(RandomKUpletsAreUniform)
+		{
+			const Combination combinations(6, 3);
+			const Arrangement arrangements(5, 3);
+			const size_t draws(60000);
+
+			// 20 and 60 outcomes: each of them is expected 3000 and 1000 times, with standard deviations of about 54 and 32
+			std::vector<size_t> combinationCounts(combinations.number(), 0);
+			std::vector<size_t> arrangementCounts(arrangements.number(), 0);
+
+			for (size_t i = 0; i < draws; ++i)
+			{
+				++combinationCounts[combinations.rank(combinations.random())];
+				++arrangementCounts[arrangements.rank(arrangements.random())];
+			}
+
+			for (const auto& count : combinationCounts)
+			{
+				Assert::IsTrue(count > 2700 && count < 3300);
+			}
+
+			for (const auto& count : arrangementCounts)
+			{
+				Assert::IsTrue(count > 800 && count < 1200);
+			}
+		}
+
+
+		TEST_METHOD(RandomKUpletsFromHugeSpaces)
+		{
+			// number() would overflow: drawing does not depend on it
+			const Combination combinations(1000000000, 40);
+			const Arrangement arrangements(1000000000, 40);
+
+			const auto combination(combinations.random());
+			const auto arrangement(arrangements.random());
+
+			Assert::AreEqual(size_t(40), combination.size());
+			Assert::IsTrue(std::adjacent_find(combination.begin(), combination.end(), std::greater_equal<size_t>()) == combination.end());
+			Assert::IsTrue(combination.back() < 1000000000);
+
+			auto sorted(arrangement);
+			std::sort(sorted.begin(), sorted.end());
+
+			Assert::AreEqual(size_t(40), arrangement.size());
+			Assert::IsTrue(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+			Assert::IsTrue(sorted.back() < 1000000000);
+
+			Assert::IsTrue(Combination(5, 0).random().empty());
+			Assert::IsTrue(Arrangement(5, 0).random().empty());
+		}
+
+
+		TEST_METHOD(RandomKUpletsInBulkAreDistinct)
+		{
+			const Combination combinations(10, 4);
+			const Arrangement arrangements(6, 3);
+
+			for (size_t count : { size_t(0), size_t(1), size_t(50), combinations.number() })
+			{
+				const auto sample(combinations.random(count));
+
+				Assert::AreEqual(count, sample.size());
+
+				for (size_t i = 0; i < sample.size(); ++i)
+				{
+					Assert::IsTrue(i == 0 || combinations.rank(sample[i - 1]) < combinations.rank(sample[i]));
+				}
+			}
+
+			const auto all(arrangements.random(arrangements.number()));
+
+			for (size_t i = 0; i < all.size(); ++i)
+			{
+				Assert::IsTrue(all[i] == arrangements.unrank(i));
+			}
+
+			Assert::ExpectException<std::invalid_argument>([&combinations]() { combinations.random(combinations.number() + 1); });
+			Assert::ExpectException<std::invalid_argument>([&arrangements]() { arrangements.random(arrangements.number() + 1); });
+			Assert::ExpectException<std::overflow_error>([]() { Combination(1000000000, 40).random(2); });
+		}
+	};
+
+
+	TEST_CLASS(DepthFirstCombinationsTest)
+	{
+	public:
+		TEST_METHOD(DepthFirstCombinationsLeavesAreCombinations)
+		{
+			for (size_t n = 1; n <= 8; ++n)
+			{
+				for (size_t k = 1; k <= n; ++k)
+				{
+					DepthFirstCombination tree(n, k);
+					Combination reference(n, k);
+					std::vector<size_t> parent;
+
+					while (tree.next())
+					{
+						// Each prefix is a child of the previous one or a sibling of one of its ancestors
+						Assert::IsTrue(tree.depth() >= 1 && tree.depth() <= std::min(k, parent.size() + 1));
+						Assert::IsTrue(std::equal(tree.kUplet().begin(), tree.kUplet().end() - 1, parent.begin()));
+						Assert::IsTrue(tree.depth() > parent.size() || tree.kUplet().back() > parent[tree.depth() - 1]);
+
+						if (tree.complete())
+						{
+							Assert::IsTrue(reference.next());
+							Assert::IsTrue(reference.kUplet() == tree.kUplet());
+						}
+
+						parent = tree.kUplet();
+					}
+
+					Assert::IsFalse(reference.next());
+					Assert::IsFalse(tree.next());
+				}
+			}
+
+			Assert::IsFalse(DepthFirstCombination(3, 0).next());
+			Assert::ExpectException<std::invalid_argument>([]() { DepthFirstCombination(3, 4); });
+		}
+
+
+		TEST_METHOD(DepthFirstCombinationsSkipSubtrees)
+		{
+			// Combinations of 4 elements among 12 whose sum is 10 at most: prefixes whose sum already exceeds it are pruned
+			DepthFirstCombination tree(12, 4);
+			Combination reference(12, 4);
+			size_t visited(0);
+
+			while (tree.next())
+			{
+				++visited;
+
+				const size_t sum(std::accumulate(tree.kUplet().begin(), tree.kUplet().end(), size_t(0)));
+
+				if (sum > 10)
+				{
+					tree.skipSubtree();
+				}
+				else if (tree.complete())
+				{
+					do
+					{
+						Assert::IsTrue(reference.next());
+					} while (std::accumulate(reference.kUplet().begin(), reference.kUplet().end(), size_t(0)) > 10);
+
+					Assert::IsTrue(reference.kUplet() == tree.kUplet());
+				}
+			}
+
+			while (reference.next())
+			{
+				Assert::IsTrue(std::accumulate(reference.kUplet().begin(), reference.kUplet().end(), size_t(0)) > 10);
+			}
+
+			DepthFirstCombination unpruned(12, 4);
+			size_t unprunedVisited(0);
+
+			while (unpruned.next())
+			{
+				++unprunedVisited;
+			}
+
+			Assert::IsTrue(visited < unprunedVisited);
+		}
+	};
+
+
+	TEST_CLASS(FixedEnumerationsTest)
+	{
+	public:
+		TEST_METHOD(FixedCombinationsMatchCombinations)
+		{
+			static_assert(FixedCombination<4>::k() == 4, "k should be a constant expression.");
+
+			Combination reference(9, 4);
+			FixedCombination<4, uint8_t> fixed(9);
+
+			Assert::AreEqual(reference.number(), fixed.number());
+
+			while (reference.next())
+			{
+				Assert::IsTrue(fixed.next());
+				Assert::IsTrue(std::equal(reference.kUplet().begin(), reference.kUplet().end(), fixed.kUplet().begin()));
+			}
+
+			Assert::IsFalse(fixed.next());
+			Assert::IsFalse(fixed.next());
+			Assert::IsFalse(FixedCombination<0>(3).next());
+
+			fixed.seek(42);
+			Assert::IsTrue(fixed.next());
+			Assert::AreEqual(size_t(42), reference.rank({ fixed.kUplet().begin(), fixed.kUplet().end() }));
+		}
+
+
+		TEST_METHOD(FixedArrangementsMatchArrangements)
+		{
+			Arrangement reference(6, 3);
+			FixedArrangement<3> fixed(6);
+
+			Assert::AreEqual(reference.number(), fixed.number());
+
+			while (reference.next())
+			{
+				Assert::IsTrue(fixed.next());
+				Assert::IsTrue(std::equal(reference.kUplet().begin(), reference.kUplet().end(), fixed.kUplet().begin()));
+			}
+
+			Assert::IsFalse(fixed.next());
+			Assert::IsFalse(fixed.next());
+
+			fixed.seek(57);
+
+			for (size_t index = 57; index < reference.number(); ++index)
+			{
+				Assert::IsTrue(fixed.next());
+				Assert::AreEqual(index, reference.rank({ fixed.kUplet().begin(), fixed.kUplet().end() }));
+			}
+
+			Assert::IsFalse(fixed.next());
+		}
+
+
+		TEST_METHOD(FixedEnumerationsNextBatchGivesNextKUplets)
+		{
+			FixedCombination<2, uint8_t> combi(5);
+			uint8_t buffer[2 * 4];
+
+			Assert::AreEqual(size_t(4), combi.nextBatch(buffer, 4));
+			Assert::IsTrue(std::vector<uint8_t>{ { 0, 1, 0, 2, 0, 3, 0, 4 } } == std::vector<uint8_t>(buffer, buffer + 8));
+
+			Assert::AreEqual(size_t(4), combi.nextBatch(buffer, 4));
+			Assert::AreEqual(size_t(2), combi.nextBatch(buffer, 4));
+			Assert::IsTrue(std::vector<uint8_t>{ { 2, 4, 3, 4 } } == std::vector<uint8_t>(buffer, buffer + 4));
+			Assert::AreEqual(size_t(0), combi.nextBatch(buffer, 4));
+		}
+
+
+		TEST_METHOD(FixedEnumerationsThrowAppropriately)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { FixedCombination<6>(5); });
+			Assert::ExpectException<std::invalid_argument>([]() { FixedArrangement<6>(5); });
+			Assert::ExpectException<std::invalid_argument>([]() { FixedCombination<2, uint8_t>(257); });
+			Assert::ExpectException<std::out_of_range>([]() { FixedCombination<2>(5).seek(10); });
+
+			FixedCombination<2, uint8_t>(256);
+		}
+	};
+
+
+	TEST_CLASS(NumbersTest)
+	{
+	public:
+		TEST_METHOD(NumbersDoNotOverflowBeforeTheirResult)
+		{
+			Assert::AreEqual(size_t(155117520), Combination::number(30, 15));
+			Assert::AreEqual(size_t(126410606437752), Combination::number(50, 25));
+			Assert::AreEqual(size_t(2432902008176640000ULL), Arrangement::number(20, 20));
+			Assert::AreEqual(size_t(5191778592000), Arrangement::number(30, 9));
+		}
+
+
+		TEST_METHOD(NumbersThrowIfOverflowing)
+		{
+			Assert::ExpectException<std::overflow_error>([]() { return Combination::number(68, 34); });
+			Assert::ExpectException<std::overflow_error>([]() { return Arrangement::number(30, 21); });
+		}
+	};
+}
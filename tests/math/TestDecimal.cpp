@@ -0,0 +1,163 @@
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <sstream>
+
+#include <shlublu/math/Decimal.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_Decimal
+{
+	typedef Math::Decimal<2> Money;
+	typedef Math::Decimal<6> Rate;
+
+
+	TEST_CLASS(DecimalTest)
+	{
+	public:
+		TEST_METHOD(DecimalConstructionIsCorrect)
+		{
+			static_assert(Money::unitsPerOne == 100, "Should be a constant expression.");
+			static_assert(Money(12).units() == 1200, "Should be usable in constant expressions.");
+
+			Assert::AreEqual(int64_t(0), Money().units());
+			Assert::AreEqual(int64_t(-500), Money(-5).units());
+			Assert::AreEqual(int64_t(1999), Money(19.99).units());
+			Assert::AreEqual(int64_t(-1999), Money(-19.99).units());
+			Assert::AreEqual(int64_t(1235), Money(Math::Decimal<3>::fromUnits(12345)).units());
+			Assert::AreEqual(int64_t(-1235), Money(Math::Decimal<3>::fromUnits(-12345)).units());
+			Assert::AreEqual(int64_t(123450), Math::Decimal<4>(Math::Decimal<3>::fromUnits(12345)).units());
+
+			Assert::AreEqual(12.34, Money::fromUnits(1234).toDouble());
+		}
+
+
+		TEST_METHOD(DecimalConstructionThrowsWhenOutOfRange)
+		{
+			Assert::ExpectException<std::overflow_error>([]() { Math::Decimal<18>(10); });
+			Assert::ExpectException<std::overflow_error>([]() { Money(1e300); });
+			Assert::ExpectException<std::invalid_argument>([]() { Money(std::nan("")); });
+			Assert::ExpectException<std::overflow_error>([]() { Math::Decimal<4>(Money::fromUnits(INT64_MAX)); });
+		}
+
+
+		TEST_METHOD(DecimalRoundingModesAreCorrect)
+		{
+			const Math::Decimal<3> values[] = { Math::Decimal<3>::fromUnits(1125), Math::Decimal<3>::fromUnits(1135), Math::Decimal<3>::fromUnits(-1125), Math::Decimal<3>::fromUnits(1121) };
+
+			const int64_t expected[][4] =
+			{
+				{ 113, 114, -113, 112 },	// HalfAwayFromZero
+				{ 112, 114, -112, 112 },	// HalfEven
+				{ 112, 113, -112, 112 },	// TowardZero
+				{ 112, 113, -113, 112 },	// Down
+				{ 113, 114, -112, 113 }		// Up
+			};
+
+			const Math::RoundingMode modes[] = { Math::RoundingMode::HalfAwayFromZero, Math::RoundingMode::HalfEven, Math::RoundingMode::TowardZero, Math::RoundingMode::Down, Math::RoundingMode::Up };
+
+			for (size_t m = 0; m < 5; ++m)
+			{
+				for (size_t v = 0; v < 4; ++v)
+				{
+					Assert::AreEqual(expected[m][v], Money(values[v], modes[m]).units());
+					Assert::AreEqual(expected[m][v] * 10, Math::roundX(values[v], 2, modes[m]).units());
+				}
+			}
+
+			Assert::AreEqual(int64_t(2), Money(0.025, Math::RoundingMode::HalfEven).units());
+			Assert::AreEqual(int64_t(-3), Money(-0.025).units());
+		}
+
+
+		TEST_METHOD(DecimalArithmeticIsExact)
+		{
+			// 0.1 + 0.2 != 0.3 with double
+			Assert::IsTrue(Money(0.1) + Money(0.2) == Money(0.3));
+			Assert::AreEqual(std::string("-0.05"), (Money(0.1) - Money(0.15)).toString());
+			Assert::AreEqual(std::string("0.50"), (-Money(-0.5)).toString());
+
+			const Money price(Money::fromUnits(1999));
+			const Math::Decimal<4> vatRate(0.2);
+
+			Assert::AreEqual(std::string("4.00"), (price * vatRate).toString());
+			Assert::AreEqual(std::string("23.99"), (price + price * vatRate).toString());
+			Assert::AreEqual(std::string("59.97"), (price * 3).toString());
+			Assert::AreEqual(std::string("6.67"), (Money(20) / 3).toString());
+			Assert::AreEqual(std::string("6.66"), Money(20).divide(Money(3), Math::RoundingMode::Down).toString());
+			Assert::AreEqual(std::string("12.00"), (Money(36) / Math::Decimal<1>(3)).toString());
+			Assert::AreEqual(std::string("3"), Math::Decimal<0>(3).toString());
+
+			std::ostringstream os;
+			os << Money::fromUnits(-7);
+			Assert::AreEqual(std::string("-0.07"), os.str());
+
+			Assert::IsTrue(Money(1) < Money(2));
+			Assert::IsTrue(Money(2) >= Money(2));
+		}
+
+
+		TEST_METHOD(DecimalUses128BitsIntermediateProducts)
+		{
+			// 9e12 * 1e6 does not fit 64 bits before the division by the scale
+			const Money large(9000000000000LL);
+			const Rate ratio(Rate::fromUnits(1000001));
+
+			Assert::AreEqual(std::string("9000009000000.00"), (large * ratio).toString());
+			Assert::AreEqual(std::string("-9000009000000.00"), (-large * ratio).toString());
+			Assert::AreEqual(std::string("8999991000009.00"), large.divide(ratio).toString());
+		}
+
+
+		TEST_METHOD(DecimalThrowsOnOverflow)
+		{
+			const Money max(Money::fromUnits(INT64_MAX));
+			const Money min(Money::fromUnits(INT64_MIN));
+
+			Assert::ExpectException<std::overflow_error>([&max]() { max + Money::fromUnits(1); });
+			Assert::ExpectException<std::overflow_error>([&min]() { min - Money::fromUnits(1); });
+			Assert::ExpectException<std::overflow_error>([&max]() { max * Money(2); });
+			Assert::ExpectException<std::overflow_error>([&max]() { max * 2; });
+			Assert::ExpectException<std::overflow_error>([&min]() { -min; });
+			Assert::ExpectException<std::domain_error>([&max]() { max / Money(); });
+
+			Assert::AreEqual(INT64_MIN, (min * Money(1)).units());
+
+			// 31 * 595056260442243600.5 is 2^64 - 0.5: rounding the quotient away from zero would wrap its magnitude around to zero
+			const Math::Decimal<0> factor(Math::Decimal<0>::fromUnits(31));
+			const Math::Decimal<1> large(Math::Decimal<1>::fromUnits(5950562604422436005));
+
+			for (auto mode : { Math::RoundingMode::HalfAwayFromZero, Math::RoundingMode::HalfEven, Math::RoundingMode::Up, Math::RoundingMode::TowardZero })
+			{
+				Assert::ExpectException<std::overflow_error>([&factor, &large, mode]() { factor.multiply(large, mode); });
+			}
+
+			for (auto mode : { Math::RoundingMode::HalfAwayFromZero, Math::RoundingMode::HalfEven, Math::RoundingMode::Down, Math::RoundingMode::TowardZero })
+			{
+				Assert::ExpectException<std::overflow_error>([&factor, &large, mode]() { (-factor).multiply(large, mode); });
+			}
+		}
+
+
+		TEST_METHOD(DecimalMathOverloadsAreCorrect)
+		{
+			Assert::AreEqual(std::string("1.2400"), Math::round2(Math::Decimal<4>(1.2351)).toString());
+			Assert::AreEqual(int64_t(12400), Math::round2(Math::Decimal<4>(1.2351)).units());
+			Assert::AreEqual(int64_t(1235), Math::roundX(Math::Decimal<3>::fromUnits(1235), 5).units());
+
+			Assert::AreEqual(std::string("0.100000"), Math::proportionalIncrease<2, 6>(Money(100), Money(110)).toString());
+			Assert::AreEqual(std::string("-0.333333"), Math::proportionalIncrease<2, 6>(Money(3), Money(2)).toString());
+			Assert::AreEqual(std::string("0.33"), Math::proportionalIncrease(Money(3), Money(4)).toString());
+			Assert::ExpectException<std::invalid_argument>([]() { Math::proportionalIncrease(Money(), Money(1)); });
+
+			Assert::AreEqual(std::string("0.100000"), Math::increaseRate(Rate(0.21), 2).toString());
+			Assert::ExpectException<std::domain_error>([]() { Math::increaseRate(Rate(-1), 2); });
+		}
+	};
+}
@@ -1,306 +1,1126 @@
-#define NOMINMAX
-
-#include "CppUnitTest.h"
-
-#include <shlublu/math/Math.h>
-#include <shlublu/util/Debug.h>
-SHLUBLU_OPTIMIZE_OFF();
-
-
-using namespace Microsoft::VisualStudio::CppUnitTestFramework;
-using namespace shlublu;
-
-namespace math_Math
-{
-	TEST_CLASS(factorialTest)
-	{
-	public:
-		TEST_METHOD(factorialReturnsProperResult)
-		{
-			// size_t
-			size_t lastSizet(Math::factorial(0));
-
-			Assert::AreEqual(size_t(1), lastSizet);
-
-			for (size_t n = 1; n < 100; ++n)
-			{
-				const size_t result(Math::factorial(n));
-				Assert::AreEqual(n * lastSizet, result);
-
-				lastSizet = result;
-			}
-
-			// double
-			double lastDouble(Math::factorial(0));
-
-			Assert::AreEqual(double(1), lastDouble);
-
-			for (double n = 1; n < 100; ++n)
-			{
-				const double result(Math::factorial(n));
-				Assert::AreEqual(n * lastDouble, result);
-
-				lastDouble = result;
-			}
-		}
-
-		TEST_METHOD(factorialThrowsIfNegativeN)
-		{
-			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(-1); });
-			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(-std::numeric_limits<double>::epsilon()); });
-			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(-std::numeric_limits<float>::epsilon()); });
-		}
-
-
-		TEST_METHOD(factorialThrowsIfNotRoundN)
-		{
-			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(0.1); });
-			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(0.1f); });
-		}
-	};
-
-
-	TEST_CLASS(clampTest)
-	{
-	public:
-		TEST_METHOD(clampCutsWhatItShouldButLeavesTheRestUnchanged)
-		{
-			Assert::AreEqual(2, Math::clamp(-6, 2, 5));
-			Assert::AreEqual(2, Math::clamp(2, 2, 5));
-			Assert::AreEqual(3, Math::clamp(3, 2, 5));
-			Assert::AreEqual(5, Math::clamp(5, 2, 5));
-			Assert::AreEqual(5, Math::clamp(8, 2, 5));
-			Assert::AreEqual(-5, Math::clamp(8, -5, -5));
-
-			Assert::AreEqual(2.0, Math::clamp(-6.0, 2.0, 5.0));
-			Assert::AreEqual(2.0, Math::clamp(2.0, 2.0, 5.0));
-			Assert::AreEqual(3.0, Math::clamp(3.0, 2.0, 5.0));
-			Assert::AreEqual(5.0, Math::clamp(5.0, 2.0, 5.0));
-			Assert::AreEqual(5.0, Math::clamp(8.0, 2.0, 5.0));
-			Assert::AreEqual(-5.0, Math::clamp(8.0, -5.0, -5.0));
-
-			Assert::AreEqual(2.0f, Math::clamp(-6.0f, 2.0f, 5.0f));
-			Assert::AreEqual(2.0f, Math::clamp(2.0f, 2.0f, 5.0f));
-			Assert::AreEqual(3.0f, Math::clamp(3.0f, 2.0f, 5.0f));
-			Assert::AreEqual(5.0f, Math::clamp(5.0f, 2.0f, 5.0f));
-			Assert::AreEqual(5.0f, Math::clamp(8.0f, 2.0f, 5.0f));
-			Assert::AreEqual(-5.0f, Math::clamp(8.0f, -5.0f, -5.0f));
-		}
-
-
-		TEST_METHOD(clampThrowsWhenMinIsGreaterThanMax)
-		{
-			Assert::ExpectException<std::invalid_argument>([]() { return Math::clamp(10, 100, 1); });
-		}
-	};
-
-
-	TEST_CLASS(roundXTest)
-	{
-	public:
-		TEST_METHOD(roundXGivesProperResult)
-		{
-			// double
-			Assert::AreEqual(4.0, Math::roundX(4.2356, 0));
-			Assert::AreEqual(5.0, Math::roundX(4.5356, 0));
-
-			Assert::AreEqual(4.2, Math::roundX(4.2356, 1));
-			Assert::AreEqual(4.3, Math::roundX(4.2556, 1));
-
-			Assert::AreEqual(4.23, Math::roundX(4.2346, 2));
-			Assert::AreEqual(4.24, Math::roundX(4.2356, 2));
-
-			Assert::AreEqual(4.234, Math::roundX(4.2343, 3));
-			Assert::AreEqual(4.235, Math::roundX(4.2345, 3));
-
-			// float
-			Assert::AreEqual(4.0f, Math::roundX(4.2356f, 0));
-			Assert::AreEqual(5.0f, Math::roundX(4.5356f, 0));
-
-			Assert::AreEqual(4.2f, Math::roundX(4.2356f, 1));
-			Assert::AreEqual(4.3f, Math::roundX(4.2556f, 1));
-
-			Assert::AreEqual(4.23f, Math::roundX(4.2346f, 2));
-			Assert::AreEqual(4.24f, Math::roundX(4.2356f, 2));
-
-			Assert::AreEqual(4.234f, Math::roundX(4.2343f, 3));
-			Assert::AreEqual(4.235f, Math::roundX(4.2345f, 3));
-		}
-		
-		TEST_METHOD(round2GivesRoundX)
-		{
-			// double
-			Assert::AreEqual(Math::round2(4.2346), Math::roundX(4.2346, 2));
-			Assert::AreEqual(Math::round2(4.5346), Math::roundX(4.5346, 2));
-
-			// float
-			Assert::AreEqual(Math::round2(4.2346f), Math::roundX(4.2346f, 2));
-			Assert::AreEqual(Math::round2(4.5346f), Math::roundX(4.5346f, 2));
-		}
-	};
-
-
-	TEST_CLASS(proportionalIncreaseTest)
-	{
-	public:
-		TEST_METHOD(proportionalIncreaseGivesProperResultWithValuesOfSameSign)
-		{
-			// double
-			Assert::AreEqual(1.0, Math::proportionalIncrease(1.0, 2.0));
-			Assert::AreEqual(-0.5, Math::proportionalIncrease(1.0, 0.5));
-			Assert::AreEqual(0.0, Math::proportionalIncrease(4.5, 4.5));
-			Assert::AreEqual(1.0, Math::proportionalIncrease(-1.0, -2.0));
-			Assert::AreEqual(-0.5, Math::proportionalIncrease(-1.0, -0.5));
-			Assert::AreEqual(0.0, Math::proportionalIncrease(-4.5, -4.5));
-
-			// float
-			Assert::AreEqual(1.0f, Math::proportionalIncrease(1.0f, 2.0f));
-			Assert::AreEqual(-0.5f, Math::proportionalIncrease(1.0f, 0.5f));
-			Assert::AreEqual(0.0f, Math::proportionalIncrease(4.5f, 4.5f));
-			Assert::AreEqual(1.0f, Math::proportionalIncrease(-1.0f, -2.0f));
-			Assert::AreEqual(-0.5f, Math::proportionalIncrease(-1.0f, -0.5f));
-			Assert::AreEqual(0.0f, Math::proportionalIncrease(-4.5f, -4.5f));
-		}
-
-
-		TEST_METHOD(proportionalIncreaseGivesProperResultWithDistinctIncreaseAndValueTypes)
-		{
-			// double
-			Assert::AreEqual(1.0, Math::proportionalIncrease<int, double>(1, 2));
-			Assert::AreEqual(-0.5, Math::proportionalIncrease<int, double>(2, 1));
-			Assert::AreEqual(0.0, Math::proportionalIncrease<int, double>(4, 4));
-			Assert::AreEqual(1.0, Math::proportionalIncrease<int, double>(-1, -2));
-			Assert::AreEqual(-0.5, Math::proportionalIncrease<int, double>(-2, -1));
-			Assert::AreEqual(0.0, Math::proportionalIncrease<int, double>(-4, -4));
-
-			// float
-			Assert::AreEqual(1.0f, Math::proportionalIncrease<int, float>(1, 2));
-			Assert::AreEqual(-0.5f, Math::proportionalIncrease<int, float>(2, 1));
-			Assert::AreEqual(0.0f, Math::proportionalIncrease<int, float>(4, 4));
-			Assert::AreEqual(1.0f, Math::proportionalIncrease<int, float>(-1, -2));
-			Assert::AreEqual(-0.5f, Math::proportionalIncrease<int, float>(-2, -1));
-			Assert::AreEqual(0.0f, Math::proportionalIncrease<int, float>(-4, -4));
-		}
-
-
-		TEST_METHOD(proportionalIncreaseGivesProperResultWithFinalValueOfZero)
-		{
-			// double
-			Assert::AreEqual(-1.0, Math::proportionalIncrease(4.0, 0.0));
-			Assert::AreEqual(-1.0, Math::proportionalIncrease(-4.0, 0.0));
-
-			// float
-			Assert::AreEqual(-1.0f, Math::proportionalIncrease(4.0f, 0.0f));
-			Assert::AreEqual(-1.0f, Math::proportionalIncrease(-4.0f, 0.0f));
-		}
-
-
-		TEST_METHOD(proportionalIncreaseGivesProperResultWithValuesOfOppositeSign)
-		{
-			// double
-			Assert::AreEqual(-3.0, Math::proportionalIncrease(-1.0, 2.0));
-			Assert::AreEqual(-1.5, Math::proportionalIncrease(1.0, -0.5));
-
-			// float
-			Assert::AreEqual(-3.0f, Math::proportionalIncrease(-1.0f, 2.0f));
-			Assert::AreEqual(-1.5f, Math::proportionalIncrease(1.0f, -0.5f));
-		}
-
-		TEST_METHOD(increaseGivesThrowsIfInitialValueIsZero)
-		{
-			Assert::ExpectException<std::invalid_argument>([]() { Math::proportionalIncrease(0.0, 1.0); });
-		}
-	};
-
-
-	TEST_CLASS(increaseRateTest)
-	{
-	public:
-		TEST_METHOD(increaseRateGivesProperResultWithProperPositiveValues)
-		{
-			// double
-			Assert::AreEqual(0.012251749322662375, Math::increaseRate(0.23, 17));
-			Assert::AreEqual(0.071773462536293131, Math::increaseRate(1.0, 10));
-			Assert::AreEqual(0.011908881146029060, Math::increaseRate(4.5, 144));
-
-			// float
-			Assert::AreEqual(0.0122517347f, Math::increaseRate(0.23f, 17));
-			Assert::AreEqual(0.0717734098f, Math::increaseRate(1.0f, 10));
-			Assert::AreEqual(0.0119088888f, Math::increaseRate(4.5f, 144));
-		}
-
-
-		TEST_METHOD(increaseRateGivesProperResultWithProperNegativeValues)
-		{
-			// double
-			Assert::AreEqual(-0.97279529489699612, Math::increaseRate(-1.0 + std::numeric_limits<double>::epsilon(), 10));
-			Assert::AreEqual(-0.0021831048363700756, Math::increaseRate(-0.27, 144));
-
-			// float
-			Assert::AreEqual(-0.796936870f, Math::increaseRate(-1.0f + std::numeric_limits<float>::epsilon(), 10));
-			Assert::AreEqual(-0.00218307972f, Math::increaseRate(-0.27f, 144));
-		}
-
-
-		TEST_METHOD(increaseRateThrowsWithZeroUnits)
-		{
-			Assert::ExpectException<std::invalid_argument>([]() { return Math::increaseRate(1.0, 0); });
-		}
-		
-
-		TEST_METHOD(increaseRateThrowsWithDecreaseExceedingInitialValue)
-		{
-			// double
-			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-1.0, 10); });
-			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-2.0, 10); });
-
-			// float
-			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-1.0f, 10); });
-			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-2.0f, 10); });
-		}
-
-
-		TEST_METHOD(increaseRateConvenienceBehavesCorrectly)
-		{
-			// double
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(1.0, 5.0), 10), Math::increaseRate(1.0, 5.0, 10));
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(5.0, 1.0), 10), Math::increaseRate(5.0, 1.0, 10));
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(1, 5), 10), Math::increaseRate<unsigned, double>(1, 5, 10));
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(5, 1), 10), Math::increaseRate<unsigned, double>(5, 1, 10));
-
-			// float
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(1.0f, 5.0f), 10), Math::increaseRate(1.0f, 5.0f, 10));
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(5.0f, 1.0f), 10), Math::increaseRate(5.0f, 1.0f, 10));
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(1, 5), 10), Math::increaseRate<unsigned, double>(1, 5, 10));
-			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(5, 1), 10), Math::increaseRate<unsigned, double>(5, 1, 10));
-		}
-	};
-
-
-	TEST_CLASS(sameSignTest)
-	{
-	public:
-		TEST_METHOD(sameSignReturnsProperResult)
-		{
-			// int
-			Assert::IsTrue(Math::sameSign(0, 5));
-			Assert::IsTrue(Math::sameSign(-5, -4));
-			Assert::IsTrue(Math::sameSign(45, 47));
-
-			Assert::IsFalse(Math::sameSign(0, -5));
-			Assert::IsFalse(Math::sameSign(5, -4));
-			Assert::IsFalse(Math::sameSign(-45, 47));
-
-			// double
-			Assert::IsTrue(Math::sameSign(-0.0, 0.0));
-
-			Assert::IsTrue(Math::sameSign(0.0, 5.0));
-			Assert::IsTrue(Math::sameSign(-5.0, -4.0));
-			Assert::IsTrue(Math::sameSign(45.0, 47.0));
-
-			Assert::IsFalse(Math::sameSign(0.0, -5.0));
-			Assert::IsFalse(Math::sameSign(5.0, -4.0));
-			Assert::IsFalse(Math::sameSign(-45.0, 47.0));
-		}
-	};
-}
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <shlublu/math/Math.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_Math
+{
+	TEST_CLASS(constantsTest)
+	{
+	public:
+		TEST_METHOD(constantsAreUsableInConstantExpressions)
+		{
+			static_assert(Math::pi<double> > 3.1415 && Math::pi<double> < 3.1416, "Should be usable in constant expressions.");
+			static_assert(Math::constantPi<float>() == Math::pi<float>, "Functions should return the variable templates.");
+
+			constexpr double halfTurns[] = { Math::piBy4<double>, Math::piBy2<double>, Math::pi<double> };
+			const char buffer[size_t(Math::e<double> * 10.0)] = { 0 };
+
+			Assert::AreEqual(size_t(27), sizeof(buffer));
+			Assert::AreEqual(2.0 * halfTurns[0], halfTurns[1]);
+			Assert::AreEqual(2.0 * halfTurns[1], halfTurns[2]);
+		}
+
+		TEST_METHOD(constantsGiveProperValues)
+		{
+			Assert::AreEqual(std::exp(1.0), Math::e<double>, 1e-15);
+			Assert::AreEqual(1.0 / std::log(2.0), Math::log2e<double>, 1e-15);
+			Assert::AreEqual(1.0 / std::log(10.0), Math::log10e<double>, 1e-15);
+			Assert::AreEqual(std::log(2.0), Math::ln2<double>, 1e-15);
+			Assert::AreEqual(std::log(10.0), Math::ln10<double>, 1e-15);
+			Assert::AreEqual(std::acos(-1.0), Math::pi<double>, 1e-15);
+			Assert::AreEqual(std::acos(0.0), Math::piBy2<double>, 1e-15);
+			Assert::AreEqual(std::atan(1.0), Math::piBy4<double>, 1e-15);
+			Assert::AreEqual(1.0 / std::acos(-1.0), Math::oneByPi<double>, 1e-15);
+			Assert::AreEqual(2.0 / std::acos(-1.0), Math::twoByPi<double>, 1e-15);
+			Assert::AreEqual(2.0 / std::sqrt(std::acos(-1.0)), Math::twoBySqrtPi<double>, 1e-15);
+			Assert::AreEqual(std::sqrt(2.0), Math::sqrt2<double>, 1e-15);
+			Assert::AreEqual(1.0 / std::sqrt(2.0), Math::oneBySqrt2<double>, 1e-15);
+
+			Assert::AreEqual(3.14159265358979323846, Math::constantPi<double>());
+			Assert::AreEqual(3.14159265358979323846f, Math::constantPi<float>());
+		}
+
+		TEST_METHOD(longDoubleConstantsAreAccurate)
+		{
+			const long double tolerance(4 * std::numeric_limits<long double>::epsilon());
+
+			Assert::IsTrue(std::fabs(std::exp(1.0L) - Math::e<long double>) <= tolerance);
+			Assert::IsTrue(std::fabs(std::log(2.0L) - Math::ln2<long double>) <= tolerance);
+			Assert::IsTrue(std::fabs(std::acos(-1.0L) - Math::pi<long double>) <= tolerance);
+			Assert::IsTrue(std::fabs(std::sqrt(2.0L) - Math::sqrt2<long double>) <= tolerance);
+			Assert::IsTrue(Math::constantPi<long double>() == Math::pi<long double>);
+
+#ifdef __SHLUBLU_FLOAT128
+			const __float128 gap(Math::pi<__float128> - __float128(Math::pi<long double>));
+
+			Assert::IsTrue(double(gap < 0 ? -gap : gap) <= double(tolerance));
+#endif
+		}
+	};
+
+
+	TEST_CLASS(factorialTest)
+	{
+	public:
+		TEST_METHOD(factorialReturnsProperResult)
+		{
+			// size_t
+			size_t lastSizet(Math::factorial(0));
+
+			Assert::AreEqual(size_t(1), lastSizet);
+
+			for (size_t n = 1; n <= 20; ++n)
+			{
+				const size_t result(Math::factorial(n));
+				Assert::AreEqual(n * lastSizet, result);
+
+				lastSizet = result;
+			}
+
+			// double
+			double lastDouble(Math::factorial(0));
+
+			Assert::AreEqual(double(1), lastDouble);
+
+			for (double n = 1; n < 100; ++n)
+			{
+				const double result(Math::factorial(n));
+				Assert::AreEqual(n * lastDouble, result);
+
+				lastDouble = result;
+			}
+		}
+
+		TEST_METHOD(factorialIsUsableInConstantExpressions)
+		{
+			static_assert(Math::factorial(size_t(20)) == size_t(2432902008176640000ULL), "20! should be computed at compile time.");
+			static_assert(Math::factorial(12) == 479001600, "12! should be computed at compile time.");
+			static_assert(Math::factorial(5.0) == 120.0, "5! should be computed at compile time.");
+
+			constexpr size_t arraySize(Math::factorial(size_t(4)));
+			const int values[arraySize] = { 0 };
+
+			Assert::AreEqual(size_t(24), sizeof(values) / sizeof(values[0]));
+		}
+
+
+		TEST_METHOD(factorialThrowsIfOverflowing)
+		{
+			Assert::ExpectException<std::overflow_error>([]() { return Math::factorial(size_t(21)); });
+			Assert::ExpectException<std::overflow_error>([]() { return Math::factorial(13); });
+			Assert::ExpectException<std::overflow_error>([]() { return Math::factorial(uint8_t(6)); });
+			Assert::ExpectException<std::overflow_error>([]() { return Math::factorial(171.0); });
+			Assert::ExpectException<std::overflow_error>([]() { return Math::factorial(35.0f); });
+
+			Assert::AreEqual(size_t(2432902008176640000ULL), Math::factorial(size_t(20)));
+			Assert::AreEqual(479001600, Math::factorial(12));
+			Assert::IsTrue(Math::factorial(170.0) < std::numeric_limits<double>::infinity());
+		}
+
+
+		TEST_METHOD(factorialThrowsIfNegativeN)
+		{
+			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(-1); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(-std::numeric_limits<double>::epsilon()); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(-std::numeric_limits<float>::epsilon()); });
+		}
+
+
+		TEST_METHOD(factorialThrowsIfNotRoundN)
+		{
+			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(0.1); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::factorial(0.1f); });
+		}
+	};
+
+
+	TEST_CLASS(logFactorialTest)
+	{
+	public:
+		TEST_METHOD(logFactorialReturnsProperResult)
+		{
+			for (double n = 0; n < 170; ++n)
+			{
+				Assert::AreEqual(std::log(Math::factorial(n)), Math::logFactorial(n), 1e-9 * std::max(1.0, std::log(Math::factorial(n))));
+			}
+
+			Assert::AreEqual(5912.1281784881633, Math::logFactorial(1000.0), 1e-9);
+		}
+
+
+		TEST_METHOD(logFactorialThrowsIfNotRoundOrNegativeN)
+		{
+			Assert::ExpectException<std::domain_error>([]() { return Math::logFactorial(-1.0); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::logFactorial(0.1); });
+		}
+	};
+
+
+	TEST_CLASS(clampTest)
+	{
+	public:
+		TEST_METHOD(clampCutsWhatItShouldButLeavesTheRestUnchanged)
+		{
+			Assert::AreEqual(2, Math::clamp(-6, 2, 5));
+			Assert::AreEqual(2, Math::clamp(2, 2, 5));
+			Assert::AreEqual(3, Math::clamp(3, 2, 5));
+			Assert::AreEqual(5, Math::clamp(5, 2, 5));
+			Assert::AreEqual(5, Math::clamp(8, 2, 5));
+			Assert::AreEqual(-5, Math::clamp(8, -5, -5));
+
+			Assert::AreEqual(2.0, Math::clamp(-6.0, 2.0, 5.0));
+			Assert::AreEqual(2.0, Math::clamp(2.0, 2.0, 5.0));
+			Assert::AreEqual(3.0, Math::clamp(3.0, 2.0, 5.0));
+			Assert::AreEqual(5.0, Math::clamp(5.0, 2.0, 5.0));
+			Assert::AreEqual(5.0, Math::clamp(8.0, 2.0, 5.0));
+			Assert::AreEqual(-5.0, Math::clamp(8.0, -5.0, -5.0));
+
+			Assert::AreEqual(2.0f, Math::clamp(-6.0f, 2.0f, 5.0f));
+			Assert::AreEqual(2.0f, Math::clamp(2.0f, 2.0f, 5.0f));
+			Assert::AreEqual(3.0f, Math::clamp(3.0f, 2.0f, 5.0f));
+			Assert::AreEqual(5.0f, Math::clamp(5.0f, 2.0f, 5.0f));
+			Assert::AreEqual(5.0f, Math::clamp(8.0f, 2.0f, 5.0f));
+			Assert::AreEqual(-5.0f, Math::clamp(8.0f, -5.0f, -5.0f));
+		}
+
+
+		TEST_METHOD(clampThrowsWhenMinIsGreaterThanMax)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { return Math::clamp(10, 100, 1); });
+		}
+	};
+
+
+	TEST_CLASS(roundXTest)
+	{
+	public:
+		TEST_METHOD(roundXGivesProperResult)
+		{
+			// double
+			Assert::AreEqual(4.0, Math::roundX(4.2356, 0));
+			Assert::AreEqual(5.0, Math::roundX(4.5356, 0));
+
+			Assert::AreEqual(4.2, Math::roundX(4.2356, 1));
+			Assert::AreEqual(4.3, Math::roundX(4.2556, 1));
+
+			Assert::AreEqual(4.23, Math::roundX(4.2346, 2));
+			Assert::AreEqual(4.24, Math::roundX(4.2356, 2));
+
+			Assert::AreEqual(4.234, Math::roundX(4.2343, 3));
+			Assert::AreEqual(4.235, Math::roundX(4.2345, 3));
+
+			// float
+			Assert::AreEqual(4.0f, Math::roundX(4.2356f, 0));
+			Assert::AreEqual(5.0f, Math::roundX(4.5356f, 0));
+
+			Assert::AreEqual(4.2f, Math::roundX(4.2356f, 1));
+			Assert::AreEqual(4.3f, Math::roundX(4.2556f, 1));
+
+			Assert::AreEqual(4.23f, Math::roundX(4.2346f, 2));
+			Assert::AreEqual(4.24f, Math::roundX(4.2356f, 2));
+
+			Assert::AreEqual(4.234f, Math::roundX(4.2343f, 3));
+			Assert::AreEqual(4.235f, Math::roundX(4.2345f, 3));
+		}
+		
+		TEST_METHOD(round2GivesRoundX)
+		{
+			// double
+			Assert::AreEqual(Math::round2(4.2346), Math::roundX(4.2346, 2));
+			Assert::AreEqual(Math::round2(4.5346), Math::roundX(4.5346, 2));
+
+			// float
+			Assert::AreEqual(Math::round2(4.2346f), Math::roundX(4.2346f, 2));
+			Assert::AreEqual(Math::round2(4.5346f), Math::roundX(4.5346f, 2));
+		}
+
+
+		TEST_METHOD(powerOfTenGivesProperResult)
+		{
+			static_assert(Math::powerOfTen<double>(3) == 1000.0, "Should be usable in constant expressions.");
+
+			for (size_t n = 0; n <= 30; ++n)
+			{
+				Assert::AreEqual(std::pow(10.0, double(n)), Math::powerOfTen<double>(n), std::pow(10.0, double(n)) * 1e-15);
+				Assert::AreEqual(std::pow(10.0f, float(n)), Math::powerOfTen<float>(n), std::pow(10.0f, float(n)) * 1e-6f);
+			}
+
+			Assert::AreEqual(1e22, Math::powerOfTen<double>(22));
+		}
+
+
+		// Halfway cases, values next to them, signed zeros, values too large to have fractional digits and non-finite values
+		template<typename T> static void checkRoundXBatchHandlesEdgeCases()
+		{
+			const T belowHalf(std::nextafter(T(0.5), T(0)));
+			std::vector<T> numbers({ T(0), -T(0), belowHalf, -belowHalf, T(1) / std::numeric_limits<T>::epsilon(), std::numeric_limits<T>::max(), std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity() });
+
+			for (int i = -40; i <= 40; ++i)
+			{
+				const T half(T(i) + T(0.5));
+
+				numbers.push_back(half);
+				numbers.push_back(std::nextafter(half, T(0)));
+				numbers.push_back(std::nextafter(half, T(i) * T(2)));
+				numbers.push_back(T(i) / T(3));
+			}
+
+			auto rounded(numbers);
+			Math::roundX(rounded.data(), rounded.size(), 0);
+
+			for (size_t i = 0; i < numbers.size(); ++i)
+			{
+				const T expected(Math::roundX(numbers[i], 0));
+
+				Assert::AreEqual(expected, rounded[i]);
+				Assert::AreEqual(std::signbit(expected), std::signbit(rounded[i]));
+			}
+
+			T nan[] = { std::numeric_limits<T>::quiet_NaN() };
+			Math::roundX(nan, 1, 2);
+
+			Assert::IsTrue(std::isnan(nan[0]));
+		}
+
+
+		TEST_METHOD(roundXBatchGivesScalarResult)
+		{
+			std::vector<double> numbers;
+
+			for (int i = -500; i < 500; ++i)
+			{
+				numbers.push_back(double(i) * 1.0370370370370370);
+			}
+
+			for (size_t digits = 0; digits <= 6; ++digits)
+			{
+				auto rounded(numbers);
+				Math::roundX(rounded, digits);
+
+				for (size_t i = 0; i < numbers.size(); ++i)
+				{
+					Assert::AreEqual(Math::roundX(numbers[i], digits), rounded[i]);
+				}
+			}
+
+			checkRoundXBatchHandlesEdgeCases<double>();
+			checkRoundXBatchHandlesEdgeCases<float>();
+
+			float floats[] = { 4.2346f, 4.5346f, -4.2356f, 0.0f };
+			Math::round2(floats, 4);
+
+			Assert::AreEqual(4.23f, floats[0]);
+			Assert::AreEqual(4.53f, floats[1]);
+			Assert::AreEqual(-4.24f, floats[2]);
+			Assert::AreEqual(0.0f, floats[3]);
+		}
+	};
+
+
+	TEST_CLASS(proportionalIncreaseTest)
+	{
+	public:
+		TEST_METHOD(proportionalIncreaseGivesProperResultWithValuesOfSameSign)
+		{
+			// double
+			Assert::AreEqual(1.0, Math::proportionalIncrease(1.0, 2.0));
+			Assert::AreEqual(-0.5, Math::proportionalIncrease(1.0, 0.5));
+			Assert::AreEqual(0.0, Math::proportionalIncrease(4.5, 4.5));
+			Assert::AreEqual(1.0, Math::proportionalIncrease(-1.0, -2.0));
+			Assert::AreEqual(-0.5, Math::proportionalIncrease(-1.0, -0.5));
+			Assert::AreEqual(0.0, Math::proportionalIncrease(-4.5, -4.5));
+
+			// float
+			Assert::AreEqual(1.0f, Math::proportionalIncrease(1.0f, 2.0f));
+			Assert::AreEqual(-0.5f, Math::proportionalIncrease(1.0f, 0.5f));
+			Assert::AreEqual(0.0f, Math::proportionalIncrease(4.5f, 4.5f));
+			Assert::AreEqual(1.0f, Math::proportionalIncrease(-1.0f, -2.0f));
+			Assert::AreEqual(-0.5f, Math::proportionalIncrease(-1.0f, -0.5f));
+			Assert::AreEqual(0.0f, Math::proportionalIncrease(-4.5f, -4.5f));
+		}
+
+
+		TEST_METHOD(proportionalIncreaseGivesProperResultWithDistinctIncreaseAndValueTypes)
+		{
+			// double
+			Assert::AreEqual(1.0, Math::proportionalIncrease<int, double>(1, 2));
+			Assert::AreEqual(-0.5, Math::proportionalIncrease<int, double>(2, 1));
+			Assert::AreEqual(0.0, Math::proportionalIncrease<int, double>(4, 4));
+			Assert::AreEqual(1.0, Math::proportionalIncrease<int, double>(-1, -2));
+			Assert::AreEqual(-0.5, Math::proportionalIncrease<int, double>(-2, -1));
+			Assert::AreEqual(0.0, Math::proportionalIncrease<int, double>(-4, -4));
+
+			// float
+			Assert::AreEqual(1.0f, Math::proportionalIncrease<int, float>(1, 2));
+			Assert::AreEqual(-0.5f, Math::proportionalIncrease<int, float>(2, 1));
+			Assert::AreEqual(0.0f, Math::proportionalIncrease<int, float>(4, 4));
+			Assert::AreEqual(1.0f, Math::proportionalIncrease<int, float>(-1, -2));
+			Assert::AreEqual(-0.5f, Math::proportionalIncrease<int, float>(-2, -1));
+			Assert::AreEqual(0.0f, Math::proportionalIncrease<int, float>(-4, -4));
+		}
+
+
+		TEST_METHOD(proportionalIncreaseGivesProperResultWithFinalValueOfZero)
+		{
+			// double
+			Assert::AreEqual(-1.0, Math::proportionalIncrease(4.0, 0.0));
+			Assert::AreEqual(-1.0, Math::proportionalIncrease(-4.0, 0.0));
+
+			// float
+			Assert::AreEqual(-1.0f, Math::proportionalIncrease(4.0f, 0.0f));
+			Assert::AreEqual(-1.0f, Math::proportionalIncrease(-4.0f, 0.0f));
+		}
+
+
+		TEST_METHOD(proportionalIncreaseGivesProperResultWithValuesOfOppositeSign)
+		{
+			// double
+			Assert::AreEqual(-3.0, Math::proportionalIncrease(-1.0, 2.0));
+			Assert::AreEqual(-1.5, Math::proportionalIncrease(1.0, -0.5));
+
+			// float
+			Assert::AreEqual(-3.0f, Math::proportionalIncrease(-1.0f, 2.0f));
+			Assert::AreEqual(-1.5f, Math::proportionalIncrease(1.0f, -0.5f));
+		}
+
+		TEST_METHOD(increaseGivesThrowsIfInitialValueIsZero)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { Math::proportionalIncrease(0.0, 1.0); });
+		}
+	};
+
+
+	TEST_CLASS(increaseRateTest)
+	{
+	public:
+		TEST_METHOD(increaseRateGivesProperResultWithProperPositiveValues)
+		{
+			// double
+			Assert::AreEqual(0.012251749322662375, Math::increaseRate(0.23, 17));
+			Assert::AreEqual(0.071773462536293131, Math::increaseRate(1.0, 10));
+			Assert::AreEqual(0.011908881146029060, Math::increaseRate(4.5, 144));
+
+			// float
+			Assert::AreEqual(0.0122517347f, Math::increaseRate(0.23f, 17));
+			Assert::AreEqual(0.0717734098f, Math::increaseRate(1.0f, 10));
+			Assert::AreEqual(0.0119088888f, Math::increaseRate(4.5f, 144));
+		}
+
+
+		TEST_METHOD(increaseRateGivesProperResultWithProperNegativeValues)
+		{
+			// double
+			Assert::AreEqual(-0.97279529489699612, Math::increaseRate(-1.0 + std::numeric_limits<double>::epsilon(), 10));
+			Assert::AreEqual(-0.0021831048363700756, Math::increaseRate(-0.27, 144));
+
+			// float
+			Assert::AreEqual(-0.796936870f, Math::increaseRate(-1.0f + std::numeric_limits<float>::epsilon(), 10));
+			Assert::AreEqual(-0.00218307972f, Math::increaseRate(-0.27f, 144));
+		}
+
+
+		TEST_METHOD(increaseRateThrowsWithZeroUnits)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { return Math::increaseRate(1.0, 0); });
+		}
+		
+
+		TEST_METHOD(increaseRateThrowsWithDecreaseExceedingInitialValue)
+		{
+			// double
+			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-1.0, 10); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-2.0, 10); });
+
+			// float
+			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-1.0f, 10); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::increaseRate(-2.0f, 10); });
+		}
+
+
+		TEST_METHOD(increaseRateConvenienceBehavesCorrectly)
+		{
+			// double
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(1.0, 5.0), 10), Math::increaseRate(1.0, 5.0, 10));
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(5.0, 1.0), 10), Math::increaseRate(5.0, 1.0, 10));
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(1, 5), 10), Math::increaseRate<unsigned, double>(1, 5, 10));
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(5, 1), 10), Math::increaseRate<unsigned, double>(5, 1, 10));
+
+			// float
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(1.0f, 5.0f), 10), Math::increaseRate(1.0f, 5.0f, 10));
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease(5.0f, 1.0f), 10), Math::increaseRate(5.0f, 1.0f, 10));
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(1, 5), 10), Math::increaseRate<unsigned, double>(1, 5, 10));
+			Assert::AreEqual(Math::increaseRate(Math::proportionalIncrease<unsigned, double>(5, 1), 10), Math::increaseRate<unsigned, double>(5, 1, 10));
+		}
+	};
+
+
+	TEST_CLASS(sameSignTest)
+	{
+	public:
+		TEST_METHOD(sameSignReturnsProperResult)
+		{
+			// int
+			Assert::IsTrue(Math::sameSign(0, 5));
+			Assert::IsTrue(Math::sameSign(-5, -4));
+			Assert::IsTrue(Math::sameSign(45, 47));
+
+			Assert::IsFalse(Math::sameSign(0, -5));
+			Assert::IsFalse(Math::sameSign(5, -4));
+			Assert::IsFalse(Math::sameSign(-45, 47));
+
+			// double
+			Assert::IsTrue(Math::sameSign(-0.0, 0.0));
+
+			Assert::IsTrue(Math::sameSign(0.0, 5.0));
+			Assert::IsTrue(Math::sameSign(-5.0, -4.0));
+			Assert::IsTrue(Math::sameSign(45.0, 47.0));
+
+			Assert::IsFalse(Math::sameSign(0.0, -5.0));
+			Assert::IsFalse(Math::sameSign(5.0, -4.0));
+			Assert::IsFalse(Math::sameSign(-45.0, 47.0));
+		}
+	};
+
+
+	TEST_CLASS(binomialTest)
+	{
+	public:
+		TEST_METHOD(binomialReturnsProperResult)
+		{
+			Assert::AreEqual(size_t(1), Math::binomial(size_t(0), size_t(0)));
+			Assert::AreEqual(size_t(924), Math::binomial(size_t(12), size_t(6)));
+			Assert::AreEqual(size_t(155117520), Math::binomial(size_t(30), size_t(15)));
+			Assert::AreEqual(size_t(14226520737620288370ULL), Math::binomial(size_t(67), size_t(33)));
+			Assert::AreEqual(size_t(0), Math::binomial(size_t(5), size_t(6)));
+
+			Assert::AreEqual(0, Math::binomial(-0, 1));
+			Assert::AreEqual(252, Math::binomial(10, 5));
+
+			static_assert(Math::binomial(40, 6) == 3838380, "binomial() should be usable in constant expressions.");
+		}
+
+
+		TEST_METHOD(binomialFollowsPascalRule)
+		{
+			for (size_t n = 1; n < 67; ++n)
+			{
+				for (size_t k = 1; k <= n; ++k)
+				{
+					Assert::AreEqual(Math::binomial(n - 1, k - 1) + Math::binomial(n - 1, k), Math::binomial(n, k));
+				}
+			}
+		}
+
+
+		TEST_METHOD(binomialThrowsIfOverflowing)
+		{
+			Assert::ExpectException<std::overflow_error>([]() { return Math::binomial(size_t(68), size_t(34)); });
+			Assert::ExpectException<std::overflow_error>([]() { return Math::binomial(40, 20); });
+		}
+
+
+		TEST_METHOD(binomialThrowsIfNegative)
+		{
+			Assert::ExpectException<std::domain_error>([]() { return Math::binomial(-1, 0); });
+			Assert::ExpectException<std::domain_error>([]() { return Math::binomial(5, -1); });
+		}
+	};
+
+
+	TEST_CLASS(cachedBinomialTest)
+	{
+	public:
+		TEST_METHOD(cachedBinomialGivesBinomial)
+		{
+			for (size_t n = 100; n-- > 0; )
+			{
+				for (size_t k = 0; k <= n + 1; ++k)
+				{
+					size_t expected(0);
+
+					try
+					{
+						expected = Math::binomial(n, k);
+					}
+					catch (std::overflow_error const&)
+					{
+						Assert::ExpectException<std::overflow_error>([n, k]() { return Math::cachedBinomial(n, k); });
+						continue;
+					}
+
+					Assert::AreEqual(expected, Math::cachedBinomial(n, k));
+				}
+			}
+		}
+
+
+		TEST_METHOD(cachedBinomialHandlesLargeRows)
+		{
+			// Far beyond the rows that are cached: this would otherwise build a triangle of about 10^11 entries
+			const size_t n(1000000);
+
+			Assert::AreEqual(n, Math::cachedBinomial(n, 1));
+			Assert::AreEqual(n * (n - 1) / 2, Math::cachedBinomial(n, n - 2));
+			Assert::AreEqual(size_t(1), Math::cachedBinomial(n, n));
+			Assert::AreEqual(size_t(0), Math::cachedBinomial(n, n + 1));
+			Assert::ExpectException<std::overflow_error>([n]() { return Math::cachedBinomial(n, n / 2); });
+		}
+
+
+		TEST_METHOD(cachedBinomialIsThreadSafe)
+		{
+			std::vector<std::thread> threads;
+			std::atomic<bool> success(true);
+
+			for (size_t t = 0; t < 8; ++t)
+			{
+				threads.emplace_back
+				(
+					[t, &success]()
+					{
+						for (size_t n = 200 + t; n < 300; n += 8)
+						{
+							if (Math::cachedBinomial(n, 3) != Math::binomial(n, size_t(3)))
+							{
+								success = false;
+							}
+						}
+					}
+				);
+			}
+
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			Assert::IsTrue(success);
+		}
+	};
+
+
+	template<typename T> static std::vector<T> batchTestValues(size_t count, T offset)
+	{
+		std::vector<T> ret;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			ret.push_back(offset + T(int(i % 23) - 11) * T(0.37));
+		}
+
+		return ret;
+	}
+
+
+	TEST_CLASS(batchTest)
+	{
+	public:
+		template<typename T> static void checkBatchGivesScalarResult()
+		{
+			for (size_t count = 0; count <= 37; ++count)
+			{
+				const auto x(batchTestValues<T>(count, T(0.1)));
+				const auto y(batchTestValues<T>(count, T(-0.05)));
+				std::vector<T> dest(count);
+				std::unique_ptr<bool[]> signs(new bool[count + 1]);
+
+				Math::clamp(x.data(), dest.data(), count, T(-1), T(1.5));
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					Assert::AreEqual(Math::clamp(x[i], T(-1), T(1.5)), dest[i]);
+				}
+
+				Math::sameSign(x.data(), y.data(), signs.get(), count);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					Assert::AreEqual(Math::sameSign(x[i], y[i]), signs[i]);
+				}
+
+				Math::proportionalIncrease(x.data(), y.data(), dest.data(), count);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					Assert::AreEqual(Math::proportionalIncrease(x[i], y[i]), dest[i]);
+				}
+
+				Math::clamp(x.data(), dest.data(), count, T(-0.99), T(10));
+				Math::increaseRate(dest.data(), dest.data(), count, 12);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const T expected(Math::increaseRate(Math::clamp(x[i], T(-0.99), T(10)), 12));
+					Assert::AreEqual(expected, dest[i], T(4) * std::numeric_limits<T>::epsilon() * (T(1) + std::abs(expected)));
+				}
+			}
+		}
+
+
+		TEST_METHOD(growthBatchGivesScalarResult)
+		{
+			for (size_t count = 0; count <= 37; ++count)
+			{
+				const auto initialValues(batchTestValues<double>(count, 5.0));
+				const auto finalValues(batchTestValues<double>(count, 4.5));
+				std::vector<size_t> numPeriods;
+				std::vector<double> rates(count);
+				std::vector<double> dest(count);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					numPeriods.push_back(1 + (i * 7) % 13);
+				}
+
+				Math::increaseRate(initialValues.data(), finalValues.data(), numPeriods.data(), rates.data(), count);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const double expected(Math::increaseRate(initialValues[i], finalValues[i], numPeriods[i]));
+					Assert::AreEqual(expected, rates[i], 4.0 * std::numeric_limits<double>::epsilon() * (1.0 + std::abs(expected)));
+				}
+
+				Math::compoundedValue(initialValues.data(), rates.data(), numPeriods.data(), dest.data(), count);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					Assert::AreEqual(Math::compoundedValue(initialValues[i], rates[i], numPeriods[i]), dest[i], 1e-13 * finalValues[i]);
+					Assert::AreEqual(finalValues[i], dest[i], 1e-13 * finalValues[i]);
+				}
+			}
+		}
+
+
+		TEST_METHOD(growthBatchIsAccurateForNearlyFlatSeries)
+		{
+			std::vector<double> initialValues{ 865.40584896685561 };
+			std::vector<double> finalValues{ 865.40730570208723 };
+			std::vector<size_t> numPeriods{ 25 };
+
+			for (size_t i = 1; i < 23; ++i)
+			{
+				const double sign((i % 2) ? 1.0 : -1.0);
+
+				initialValues.push_back(initialValues.front() * (1.0 + double(i) / 7.0));
+				finalValues.push_back(initialValues.back() * (1.0 + sign * std::ldexp(double(1 + i % 5), -int(15 + i))));
+				numPeriods.push_back(1 + (i * 7) % 13);
+			}
+
+			std::vector<double> rates(initialValues.size());
+			Math::increaseRate(initialValues.data(), finalValues.data(), numPeriods.data(), rates.data(), rates.size());
+
+			for (size_t i = 0; i < rates.size(); ++i)
+			{
+				// The difference of nearby values is exact: the reference does not depend on a rounded quotient
+				const long double overallIncrease((static_cast<long double>(finalValues[i]) - initialValues[i]) / initialValues[i]);
+				const long double expected(std::expm1(std::log1p(overallIncrease) / static_cast<long double>(numPeriods[i])));
+				const double bound((4.0 + 2.0 * std::abs(std::log1p(double(expected)))) * std::ldexp(1.0, -52));
+
+				Assert::IsTrue(std::abs(double((rates[i] - expected) / expected)) <= bound);
+			}
+		}
+
+
+		TEST_METHOD(growthBatchHandlesSpecialValues)
+		{
+			const double inf(std::numeric_limits<double>::infinity());
+			const double nan(std::numeric_limits<double>::quiet_NaN());
+			const double initialValues[] = { 1.0, inf, 2.0, 1e-310, 1.0, 3.0 };
+			const double rates[] = { 0.05, 0.05, nan, 0.05, 1.0, 0.0 };
+			const size_t numPeriods[] = { 0, 3, 3, 3, 2000, 7 };
+			double dest[6];
+
+			Math::compoundedValue(initialValues, rates, numPeriods, dest, 6);
+
+			Assert::AreEqual(1.0, dest[0]);
+			Assert::AreEqual(inf, dest[1]);
+			Assert::IsTrue(std::isnan(dest[2]));
+			Assert::AreEqual(Math::compoundedValue(1e-310, 0.05, 3), dest[3]);
+			Assert::AreEqual(inf, dest[4]);
+			Assert::AreEqual(3.0, dest[5]);
+
+			const double ones[] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+			const double finalValues[] = { 1.0, inf, 2.0, 1e-310, 1e300, nan };
+			const size_t years[] = { 3, 3, 3, 3, 7, 7 };
+
+			Math::increaseRate(ones, finalValues, years, dest, 6);
+
+			Assert::AreEqual(0.0, dest[0], 1e-15);
+			Assert::AreEqual(inf, dest[1]);
+			Assert::AreEqual(Math::increaseRate(1.0, 2.0, 3), dest[2], 1e-15);
+			Assert::AreEqual(std::pow(1e-310, 1.0 / 3.0) - 1.0, dest[3]);
+			Assert::AreEqual(Math::increaseRate(1.0, 1e300, 7), dest[4], 1e-13 * dest[4]);
+			Assert::IsTrue(std::isnan(dest[5]));
+		}
+
+
+		TEST_METHOD(batchGivesScalarResult)
+		{
+			checkBatchGivesScalarResult<double>();
+			checkBatchGivesScalarResult<float>();
+		}
+
+
+		TEST_METHOD(batchHandlesSpecialValues)
+		{
+			const double nan(std::numeric_limits<double>::quiet_NaN());
+			const double values[] = { nan, -0.0, 0.0, -5.0, 5.0, nan, 1.0, -1.0, nan };
+			double dest[9];
+			bool signs[9];
+
+			Math::clamp(values, dest, 9, -2.0, 2.0);
+
+			for (size_t i = 0; i < 9; ++i)
+			{
+				Assert::AreEqual(Math::clamp(values[i], -2.0, 2.0), dest[i]);
+			}
+
+			Math::sameSign(values, values + 1, signs, 8);
+
+			for (size_t i = 0; i < 8; ++i)
+			{
+				Assert::AreEqual(Math::sameSign(values[i], values[i + 1]), signs[i]);
+			}
+		}
+
+
+		TEST_METHOD(batchThrowsOnInvalidArguments)
+		{
+			std::vector<double> values(batchTestValues<double>(20, 100.0));
+			std::vector<double> dest(values.size());
+
+			Assert::ExpectException<std::invalid_argument>([&values, &dest]() { Math::clamp(values.data(), dest.data(), values.size(), 1.0, 0.0); });
+			Assert::ExpectException<std::invalid_argument>([&values, &dest]() { Math::increaseRate(values.data(), dest.data(), values.size(), 0); });
+
+			values[13] = -1.0;
+			Assert::ExpectException<std::domain_error>([&values, &dest]() { Math::increaseRate(values.data(), dest.data(), values.size(), 2); });
+
+			for (size_t zero : { 0, 5, 17, 19 })
+			{
+				values = batchTestValues<double>(20, 100.0);
+				values[zero] = 0.0;
+
+				try
+				{
+					Math::proportionalIncrease(values.data(), values.data(), values.data(), values.size());
+					Assert::Fail();
+				}
+				catch (std::invalid_argument const& e)
+				{
+					Assert::IsTrue(std::string(e.what()).find("[" + std::to_string(zero) + "]") != std::string::npos);
+				}
+			}
+		}
+
+
+		template<typename EXCEPTION, typename FUNCTION> static void checkThrowsAt(size_t index, FUNCTION const& function)
+		{
+			try
+			{
+				function();
+				Assert::Fail();
+			}
+			catch (EXCEPTION const& e)
+			{
+				Assert::IsTrue(std::string(e.what()).find("[" + std::to_string(index) + "]") != std::string::npos);
+			}
+		}
+
+
+		TEST_METHOD(growthBatchThrowsOnInvalidArguments)
+		{
+			for (size_t index : { 0, 6, 17, 18 })
+			{
+				std::vector<double> initialValues(19, 100.0);
+				std::vector<double> finalValues(19, 150.0);
+				std::vector<size_t> numPeriods(19, 4);
+				std::vector<double> dest(19);
+
+				const auto increaseRate([&]() { Math::increaseRate(initialValues.data(), finalValues.data(), numPeriods.data(), dest.data(), dest.size()); });
+				const auto compoundedValue([&]() { Math::compoundedValue(initialValues.data(), finalValues.data(), numPeriods.data(), dest.data(), dest.size()); });
+
+				initialValues[index] = 0.0;
+				checkThrowsAt<std::invalid_argument>(index, increaseRate);
+
+				initialValues[index] = 100.0;
+				numPeriods[index] = 0;
+				checkThrowsAt<std::invalid_argument>(index, increaseRate);
+
+				numPeriods[index] = 4;
+				finalValues[index] = -1.0;
+				checkThrowsAt<std::domain_error>(index, increaseRate);
+				checkThrowsAt<std::domain_error>(index, compoundedValue);
+
+				finalValues[index] = -2.0;
+				checkThrowsAt<std::domain_error>(index, compoundedValue);
+			}
+
+			Assert::ExpectException<std::domain_error>([]() { Math::compoundedValue(100.0, -1.0, 4); });
+		}
+	};
+
+
+	TEST_CLASS(fastTest)
+	{
+	public:
+		TEST_METHOD(fastFunctionsMeetTheirErrorBounds)
+		{
+			for (int i = -7000; i <= 7000; i += 7)
+			{
+				const double x(double(i) / 10.0 + 0.0123);
+				const double positive(std::exp(double(i) / 20.0));
+				const double y(double(i % 61) / 2.0);
+
+				Assert::AreEqual(std::exp(x), Math::fastExp(x), std::exp(x) * 1e-8);
+				Assert::AreEqual(std::log(positive), Math::fastLog(positive), 1e-9);
+				const double power(std::pow(positive, y));
+
+				// y * log(positive) goes far beyond the range of exp(): both overflow, and a tolerance would compare infinities
+				if (std::isfinite(power))
+				{
+					Assert::AreEqual(power, Math::fastPow(positive, y), power * 1e-8 * (1.0 + std::abs(y * std::log(positive))));
+				}
+				else
+				{
+					Assert::IsTrue(std::isinf(Math::fastPow(positive, y)));
+				}
+				Assert::AreEqual(1.0 / (1.0 + std::exp(-x)), Math::fastSigmoid(x), 1e-8 / (1.0 + std::exp(-x)));
+			}
+
+			for (int i = -800; i <= 800; ++i)
+			{
+				const float x(float(i) / 10.0f);
+
+				Assert::AreEqual(std::exp(x), Math::fastExp(x), std::exp(x) * std::numeric_limits<float>::epsilon());
+				Assert::AreEqual(std::log(std::abs(x) + 1.0f), Math::fastLog(std::abs(x) + 1.0f), std::log(std::abs(x) + 1.0f) * std::numeric_limits<float>::epsilon());
+			}
+		}
+
+
+		TEST_METHOD(fastFunctionsHandleSpecialValues)
+		{
+			const double inf(std::numeric_limits<double>::infinity());
+			const double nan(std::numeric_limits<double>::quiet_NaN());
+
+			Assert::AreEqual(inf, Math::fastExp(inf));
+			Assert::AreEqual(inf, Math::fastExp(1000.0));
+			Assert::AreEqual(0.0, Math::fastExp(-inf));
+			Assert::AreEqual(0.0, Math::fastExp(-1000.0));
+			Assert::AreEqual(std::exp(-740.0), Math::fastExp(-740.0), std::exp(-740.0) * 1e-2);
+			Assert::IsTrue(std::isnan(Math::fastExp(nan)));
+
+			Assert::AreEqual(-inf, Math::fastLog(0.0));
+			Assert::AreEqual(inf, Math::fastLog(inf));
+			Assert::AreEqual(std::log(1e-310), Math::fastLog(1e-310));
+			Assert::IsTrue(std::isnan(Math::fastLog(-1.0)));
+			Assert::IsTrue(std::isnan(Math::fastLog(nan)));
+
+			Assert::AreEqual(0.0, Math::fastPow(0.0, 2.0));
+			Assert::AreEqual(-8.0, Math::fastPow(-2.0, 3.0));
+			Assert::AreEqual(inf, Math::fastPow(2.0, inf));
+			Assert::AreEqual(1.0, Math::fastPow(1.0, nan));
+
+			Assert::AreEqual(1.0, Math::fastSigmoid(inf));
+			Assert::AreEqual(0.0, Math::fastSigmoid(-inf));
+			Assert::AreEqual(0.5, Math::fastSigmoid(0.0));
+		}
+
+
+		template<typename T> static void checkFastBatchGivesScalarResult()
+		{
+			for (size_t count = 0; count <= 37; ++count)
+			{
+				auto x(batchTestValues<T>(count, T(0.5)));
+				auto y(batchTestValues<T>(count, T(1)));
+				std::vector<T> dest(count);
+
+				x.push_back(std::numeric_limits<T>::infinity());
+				y.push_back(-std::numeric_limits<T>::infinity());
+				x.push_back(T(0));
+				y.push_back(T(0));
+				dest.resize(x.size());
+
+				Math::fastExp(x.data(), dest.data(), x.size());
+
+				for (size_t i = 0; i < x.size(); ++i)
+				{
+					Assert::AreEqual(Math::fastExp(x[i]), dest[i]);
+				}
+
+				Math::fastLog(y.data(), dest.data(), y.size());
+
+				for (size_t i = 0; i < y.size(); ++i)
+				{
+					Assert::IsTrue(Math::fastLog(y[i]) == dest[i] || (std::isnan(Math::fastLog(y[i])) && std::isnan(dest[i])));
+				}
+
+				Math::fastPow(y.data(), x.data(), dest.data(), x.size());
+
+				for (size_t i = 0; i < x.size(); ++i)
+				{
+					Assert::IsTrue(Math::fastPow(y[i], x[i]) == dest[i] || (std::isnan(Math::fastPow(y[i], x[i])) && std::isnan(dest[i])));
+				}
+
+				Math::fastSigmoid(x.data(), dest.data(), x.size());
+
+				for (size_t i = 0; i < x.size(); ++i)
+				{
+					Assert::AreEqual(Math::fastSigmoid(x[i]), dest[i]);
+				}
+			}
+		}
+
+
+		TEST_METHOD(fastBatchGivesScalarResult)
+		{
+			checkFastBatchGivesScalarResult<double>();
+			checkFastBatchGivesScalarResult<float>();
+		}
+	};
+
+
+	TEST_CLASS(sumTest)
+	{
+	public:
+		TEST_METHOD(sumGivesProperResult)
+		{
+			Assert::AreEqual(0.0, Math::sum<double>(nullptr, 0));
+			Assert::AreEqual(0.0, Math::compensatedSum<double>(nullptr, 0));
+
+			for (size_t count : { 1, 3, 4, 127, 128, 129, 1000, 100003 })
+			{
+				std::vector<double> values;
+
+				for (size_t i = 1; i <= count; ++i)
+				{
+					values.push_back(double(i));
+				}
+
+				const double expected(double(count) * double(count + 1) / 2.0);
+
+				Assert::AreEqual(expected, Math::sum(values));
+				Assert::AreEqual(expected, Math::compensatedSum(values));
+			}
+		}
+
+
+		TEST_METHOD(sumIsAccurate)
+		{
+			// 0.1 is not representable: a plain loop drifts by about 1e-6 here
+			const std::vector<double> tenths(10000000, 0.1);
+
+			Assert::AreEqual(1e6, Math::sum(tenths), 1e-8);
+			Assert::AreEqual(1e6, Math::compensatedSum(tenths), 1e-9);
+
+			const std::vector<float> floatTenths(1000000, 0.1f);
+
+			Assert::AreEqual(100000.0, double(Math::sum(floatTenths)), 0.05);
+			Assert::AreEqual(100000.0, double(Math::compensatedSum(floatTenths)), 0.01);
+		}
+
+
+		TEST_METHOD(compensatedSumHandlesCancellation)
+		{
+			const std::vector<double> values{ 1.0, 1e100, 1.0, -1e100, 3.0, 1e-20, 5.0, 7.0, -1e50, 1e50 };
+
+			Assert::AreEqual(17.0, Math::compensatedSum(values));
+		}
+
+
+		TEST_METHOD(dotGivesProperResult)
+		{
+			const std::vector<double> a{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+			const std::vector<double> b{ 5.0, 4.0, 3.0, 2.0, 1.0 };
+
+			Assert::AreEqual(35.0, Math::dot(a, b));
+			Assert::AreEqual(0.0, Math::dot<double>(nullptr, nullptr, 0));
+
+			// Products are exactly 1 + 2^-30 + 2^-60 and -1: only the rounding errors of the products remain
+			const double x(1.0 + std::ldexp(1.0, -30));
+			const std::vector<double> c{ x, 1.0, x, 1.0, x, 1.0 };
+			const std::vector<double> d{ x, -1.0, x, -1.0, x, -1.0 };
+
+			Assert::AreEqual(3.0 * (std::ldexp(1.0, -29) + std::ldexp(1.0, -60)), Math::dot(c, d));
+			Assert::AreEqual(3.0 * (std::ldexp(1.0, -29) + std::ldexp(1.0, -60)), Math::dot<double>(c.data(), d.data(), c.size()));
+		}
+
+
+		template<typename T> static void checkDotCancelsLargeProducts(size_t count)
+		{
+			// Each product is followed by its opposite, which only leaves the last term: a naive sum would mostly return rounding errors
+			std::vector<T> a;
+			std::vector<T> b;
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const T x(T(1) + T(i % 97) / T(7));
+				const T y(T(1e3) * (T(1) + T(i % 89) / T(3)));
+
+				a.insert(a.end(), { x, -x });
+				b.insert(b.end(), { y, y });
+			}
+
+			a.push_back(T(1));
+			b.push_back(T(1e-3));
+
+			// Error of the compensated sum: rounding of the result, plus a second order term relative to the magnitude of the products
+			const double epsilon(std::numeric_limits<T>::epsilon());
+			double magnitude(0.0);
+
+			for (size_t i = 0; i < a.size(); ++i)
+			{
+				magnitude += std::abs(double(a[i]) * double(b[i]));
+			}
+
+			const double tolerance(epsilon * 1e-3 + epsilon * epsilon * magnitude);
+
+			// The overload for float and double, which may use AVX2 and FMA instructions, and the portable template
+			Assert::AreEqual(double(T(1e-3)), double(Math::dot(a.data(), b.data(), a.size())), tolerance);
+			Assert::AreEqual(double(T(1e-3)), double(Math::dot<T>(a.data(), b.data(), a.size())), tolerance);
+		}
+
+
+		TEST_METHOD(dotCompensatesRoundingErrors)
+		{
+			for (size_t count : { 0, 1, 5, 13, 3000 })
+			{
+				checkDotCancelsLargeProducts<double>(count);
+				checkDotCancelsLargeProducts<float>(count);
+				checkDotCancelsLargeProducts<long double>(count);
+			}
+
+			// Products whose rounding errors are not representable as a sum of two values of the type: they add up over many elements
+			std::vector<double> a;
+			std::vector<double> b;
+			long double expected(0);
+
+			for (size_t i = 0; i < 10000; ++i)
+			{
+				a.push_back(1.0 + double(i) * std::ldexp(1.0, -40));
+				b.push_back(1.0 - double(i) * std::ldexp(1.0, -41));
+				expected += (long double)(a.back()) * (long double)(b.back());
+			}
+
+			Assert::AreEqual(double(expected), Math::dot(a, b), double(expected) * 1e-16);
+			Assert::AreEqual(double(expected), Math::dot<double>(a.data(), b.data(), a.size()), double(expected) * 1e-16);
+		}
+
+
+		TEST_METHOD(dotThrowsIfSizesDiffer)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { Math::dot(std::vector<double>(3), std::vector<double>(4)); });
+		}
+	};
+}
@@ -0,0 +1,251 @@
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <shlublu/math/Rolling.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_Rolling
+{
+	static std::vector<double> testSeries(size_t count)
+	{
+		std::vector<double> ret;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			// Offset far from zero to exercise numerical stability, with runs of increasing and decreasing values
+			ret.push_back(1e6 + double((i * 7919) % 1000) / 10.0 + std::sin(double(i) / 5.0) * 50.0);
+		}
+
+		return ret;
+	}
+
+
+	TEST_CLASS(RollingStatisticsTest)
+	{
+	public:
+		TEST_METHOD(RollingStatisticsGivesExpectedResults)
+		{
+			Math::RollingStatistics window(4);
+
+			window.push(2.0);
+			window.push(4.0);
+
+			Assert::AreEqual(size_t(2), window.count());
+			Assert::IsFalse(window.full());
+			Assert::AreEqual(6.0, window.sum());
+			Assert::AreEqual(3.0, window.mean());
+			Assert::AreEqual(1.0, window.variance(), 1e-15);
+			Assert::AreEqual(2.0, window.sampleVariance(), 1e-15);
+
+			for (double x : { 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 })
+			{
+				window.push(x);
+			}
+
+			// 5, 5, 7, 9
+			Assert::AreEqual(size_t(4), window.count());
+			Assert::IsTrue(window.full());
+			Assert::AreEqual(26.0, window.sum());
+			Assert::AreEqual(6.5, window.mean());
+			Assert::AreEqual(2.75, window.variance(), 1e-14);
+			Assert::AreEqual(11.0 / 3.0, window.sampleVariance(), 1e-14);
+			Assert::AreEqual(std::sqrt(2.75), window.standardDeviation(), 1e-14);
+		}
+
+
+		TEST_METHOD(RollingStatisticsMatchesRecomputation)
+		{
+			const auto series(testSeries(5000));
+
+			for (size_t windowSize : { 1, 2, 7, 100 })
+			{
+				Math::RollingStatistics window(windowSize);
+
+				for (size_t i = 0; i < series.size(); ++i)
+				{
+					window.push(series[i]);
+
+					const size_t first(i + 1 > windowSize ? i + 1 - windowSize : 0);
+					const double n(double(i + 1 - first));
+					double sum(0.0);
+
+					for (size_t j = first; j <= i; ++j)
+					{
+						sum += series[j];
+					}
+
+					double m2(0.0);
+
+					for (size_t j = first; j <= i; ++j)
+					{
+						m2 += (series[j] - sum / n) * (series[j] - sum / n);
+					}
+
+					Assert::AreEqual(sum, window.sum(), sum * 1e-14);
+					Assert::AreEqual(sum / n, window.mean(), sum / n * 1e-14);
+					Assert::AreEqual(m2 / n, window.variance(), 1e-6);
+				}
+			}
+		}
+
+
+		TEST_METHOD(RollingStatisticsBatchAndResetBehaveCorrectly)
+		{
+			const auto series(testSeries(100));
+			Math::RollingStatistics one(10);
+			Math::RollingStatistics batch(10);
+
+			one.push(-1e9);
+			one.reset();
+
+			Assert::AreEqual(size_t(0), one.count());
+			Assert::AreEqual(0.0, one.sum());
+
+			for (const auto& x : series)
+			{
+				one.push(x);
+			}
+
+			batch.push(series.data(), series.size());
+
+			Assert::AreEqual(one.sum(), batch.sum());
+			Assert::AreEqual(one.variance(), batch.variance());
+		}
+
+
+		TEST_METHOD(RollingStatisticsThrowsAppropriately)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { Math::RollingStatistics(0); });
+
+			Math::RollingStatistics window(3);
+
+			Assert::ExpectException<std::domain_error>([&window]() { window.mean(); });
+			Assert::ExpectException<std::domain_error>([&window]() { window.variance(); });
+			Assert::ExpectException<std::domain_error>([&window]() { window.standardDeviation(); });
+
+			window.push(1.0);
+
+			Assert::ExpectException<std::domain_error>([&window]() { window.sampleVariance(); });
+			Assert::AreEqual(0.0, window.variance());
+		}
+	};
+
+
+	TEST_CLASS(RollingExtremaTest)
+	{
+	public:
+		TEST_METHOD(RollingExtremaMatchesRecomputation)
+		{
+			auto series(testSeries(3000));
+
+			// Repeated values
+			std::fill(series.begin() + 100, series.begin() + 150, 42.0);
+
+			for (size_t windowSize : { 1, 2, 3, 16, 200 })
+			{
+				Math::RollingExtrema window(windowSize);
+
+				for (size_t i = 0; i < series.size(); ++i)
+				{
+					window.push(series[i]);
+
+					const auto first(series.begin() + (i + 1 > windowSize ? i + 1 - windowSize : 0));
+					const auto last(series.begin() + i + 1);
+
+					Assert::AreEqual(size_t(last - first), window.count());
+					Assert::AreEqual(*std::min_element(first, last), window.min());
+					Assert::AreEqual(*std::max_element(first, last), window.max());
+				}
+			}
+		}
+
+
+		TEST_METHOD(RollingExtremaHandlesMonotonicSeries)
+		{
+			Math::RollingExtrema window(5);
+
+			for (int i = 0; i < 20; ++i)
+			{
+				window.push(double(i));
+
+				Assert::AreEqual(double(std::max(0, i - 4)), window.min());
+				Assert::AreEqual(double(i), window.max());
+			}
+
+			window.reset();
+			Assert::AreEqual(size_t(0), window.count());
+
+			for (int i = 20; i > 0; --i)
+			{
+				window.push(double(i));
+
+				Assert::AreEqual(double(i), window.min());
+				Assert::AreEqual(double(std::min(20, i + 4)), window.max());
+			}
+		}
+
+
+		TEST_METHOD(RollingExtremaThrowsAppropriately)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { Math::RollingExtrema(0); });
+
+			Math::RollingExtrema window(3);
+
+			Assert::ExpectException<std::domain_error>([&window]() { window.min(); });
+			Assert::ExpectException<std::domain_error>([&window]() { window.max(); });
+			Assert::ExpectException<std::invalid_argument>([&window]() { window.push(std::nan("")); });
+		}
+	};
+
+
+	TEST_CLASS(ExponentialMovingAverageTest)
+	{
+	public:
+		TEST_METHOD(ExponentialMovingAverageGivesExpectedResults)
+		{
+			Math::ExponentialMovingAverage ema(0.5);
+
+			ema.push(10.0);
+			Assert::AreEqual(10.0, ema.value());
+
+			ema.push(20.0);
+			Assert::AreEqual(15.0, ema.value());
+
+			ema.push(5.0);
+			Assert::AreEqual(10.0, ema.value());
+			Assert::AreEqual(size_t(3), ema.count());
+
+			const auto span(Math::ExponentialMovingAverage::fromSpan(3));
+			Assert::AreEqual(0.5, span.alpha());
+
+			Math::ExponentialMovingAverage last(1.0);
+			const double values[] = { 3.0, 1.0, 4.0 };
+
+			last.push(values, 3);
+			Assert::AreEqual(4.0, last.value());
+
+			last.reset();
+			Assert::AreEqual(size_t(0), last.count());
+		}
+
+
+		TEST_METHOD(ExponentialMovingAverageThrowsAppropriately)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { Math::ExponentialMovingAverage(0.0); });
+			Assert::ExpectException<std::invalid_argument>([]() { Math::ExponentialMovingAverage(1.5); });
+			Assert::ExpectException<std::invalid_argument>([]() { Math::ExponentialMovingAverage(std::nan("")); });
+			Assert::ExpectException<std::invalid_argument>([]() { Math::ExponentialMovingAverage::fromSpan(0); });
+			Assert::ExpectException<std::domain_error>([]() { Math::ExponentialMovingAverage(0.1).value(); });
+		}
+	};
+}
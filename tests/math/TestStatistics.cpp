@@ -0,0 +1,193 @@
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <cmath>
+
+#include <shlublu/math/Statistics.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_Statistics
+{
+	static std::vector<double> testValues(size_t count)
+	{
+		std::vector<double> ret;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			// Skewed, offset far from zero to exercise numerical stability
+			ret.push_back(1e6 + std::pow(double((i * 7919) % 1000) / 100.0, 2.0));
+		}
+
+		return ret;
+	}
+
+
+	static void checkSameStatistics(Math::Statistics const& expected, Math::Statistics const& actual)
+	{
+		Assert::AreEqual(expected.count(), actual.count());
+		Assert::AreEqual(expected.mean(), actual.mean(), std::abs(expected.mean()) * 1e-12);
+		Assert::AreEqual(expected.variance(), actual.variance(), expected.variance() * 1e-9);
+		Assert::AreEqual(expected.min(), actual.min());
+		Assert::AreEqual(expected.max(), actual.max());
+		Assert::AreEqual(expected.skewness(), actual.skewness(), 1e-7);
+		Assert::AreEqual(expected.kurtosis(), actual.kurtosis(), 1e-7);
+	}
+
+
+	TEST_CLASS(StatisticsTest)
+	{
+	public:
+		TEST_METHOD(StatisticsGivesExpectedResults)
+		{
+			Math::Statistics stats;
+
+			for (double x : { 2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 })
+			{
+				stats.push(x);
+			}
+
+			Assert::AreEqual(size_t(8), stats.count());
+			Assert::AreEqual(5.0, stats.mean(), 1e-15);
+			Assert::AreEqual(4.0, stats.variance(), 1e-14);
+			Assert::AreEqual(32.0 / 7.0, stats.sampleVariance(), 1e-14);
+			Assert::AreEqual(2.0, stats.standardDeviation(), 1e-14);
+			Assert::AreEqual(2.0, stats.min());
+			Assert::AreEqual(9.0, stats.max());
+			Assert::AreEqual(0.65625, stats.skewness(), 1e-14);
+			Assert::AreEqual(2.78125, stats.kurtosis(), 1e-14);
+			Assert::AreEqual(2.78125 - 3.0, stats.excessKurtosis(), 1e-14);
+		}
+
+
+		TEST_METHOD(StatisticsMatchesTwoPassComputation)
+		{
+			const auto values(testValues(10000));
+
+			double mean(0.0);
+
+			for (double x : values)
+			{
+				mean += x;
+			}
+
+			mean /= double(values.size());
+
+			double m2(0.0), m3(0.0), m4(0.0);
+
+			for (double x : values)
+			{
+				const double d(x - mean);
+
+				m2 += d * d;
+				m3 += d * d * d;
+				m4 += d * d * d * d;
+			}
+
+			const double n(double(values.size()));
+
+			Math::Statistics stats;
+
+			for (double x : values)
+			{
+				stats.push(x);
+			}
+
+			Assert::AreEqual(mean, stats.mean(), mean * 1e-14);
+			Assert::AreEqual(m2 / n, stats.variance(), m2 / n * 1e-9);
+			Assert::AreEqual(std::sqrt(n) * m3 / std::pow(m2, 1.5), stats.skewness(), 1e-8);
+			Assert::AreEqual(n * m4 / (m2 * m2), stats.kurtosis(), 1e-8);
+		}
+
+
+		TEST_METHOD(StatisticsArrayPushGivesScalarResult)
+		{
+			for (size_t count : { 1, 3, 255, 256, 257, 1000, 10007 })
+			{
+				const auto values(testValues(count));
+
+				Math::Statistics scalar;
+				Math::Statistics batch;
+
+				for (double x : values)
+				{
+					scalar.push(x);
+				}
+
+				batch.push(values);
+
+				if (count > 1)
+				{
+					checkSameStatistics(scalar, batch);
+				}
+				else
+				{
+					Assert::AreEqual(scalar.mean(), batch.mean());
+				}
+			}
+		}
+
+
+		TEST_METHOD(StatisticsMergeGivesSingleAccumulatorResult)
+		{
+			const auto values(testValues(5000));
+
+			Math::Statistics overall;
+			overall.push(values);
+
+			std::vector<Math::Statistics> partials(7);
+
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				partials[(i * i) % partials.size()].push(values[i]);
+			}
+
+			Math::Statistics merged;
+
+			for (const auto& partial : partials)
+			{
+				merged.merge(partial);
+			}
+
+			checkSameStatistics(overall, merged);
+
+			merged.merge(Math::Statistics());
+			checkSameStatistics(overall, merged);
+
+			Math::Statistics doubled(overall);
+			doubled.merge(doubled);
+
+			Assert::AreEqual(2 * overall.count(), doubled.count());
+			Assert::AreEqual(overall.mean(), doubled.mean(), overall.mean() * 1e-14);
+			Assert::AreEqual(overall.variance(), doubled.variance(), overall.variance() * 1e-9);
+		}
+
+
+		TEST_METHOD(StatisticsThrowsWhenUndefined)
+		{
+			Math::Statistics stats;
+
+			Assert::AreEqual(size_t(0), stats.count());
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.mean(); });
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.variance(); });
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.min(); });
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.max(); });
+
+			stats.push(42.0);
+
+			Assert::AreEqual(0.0, stats.variance());
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.sampleVariance(); });
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.skewness(); });
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.kurtosis(); });
+
+			stats.reset();
+			Assert::AreEqual(size_t(0), stats.count());
+			Assert::ExpectException<std::domain_error>([&stats]() { stats.mean(); });
+		}
+	};
+}
@@ -0,0 +1,206 @@
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include <shlublu/math/TDigest.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace math_TDigest
+{
+	// Skewed, latency-like distribution, in a scrambled order
+	static std::vector<double> testValues(size_t count)
+	{
+		std::vector<double> ret;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const double u(double((uint64_t(i) * 2654435761u) % 4294967296u) / 4294967296.0);
+			ret.push_back(std::exp(6.0 * u));
+		}
+
+		return ret;
+	}
+
+
+	static double rankOf(std::vector<double> const& sorted, double value)
+	{
+		return double(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin()) / double(sorted.size());
+	}
+
+
+	static void checkAccuracy(Math::TDigest const& digest, std::vector<double> sorted)
+	{
+		std::sort(sorted.begin(), sorted.end());
+
+		Assert::AreEqual(0.5, rankOf(sorted, digest.quantile(0.5)), 2e-3);
+		Assert::AreEqual(0.9, rankOf(sorted, digest.quantile(0.9)), 1e-3);
+		Assert::AreEqual(0.99, rankOf(sorted, digest.quantile(0.99)), 5e-4);
+		Assert::AreEqual(0.999, rankOf(sorted, digest.quantile(0.999)), 3e-4);
+
+		Assert::AreEqual(sorted.front(), digest.quantile(0.0));
+		Assert::AreEqual(sorted.back(), digest.quantile(1.0));
+	}
+
+
+	// Serialized doubles are little-endian, as the ones of the platforms the tests run on
+	static std::vector<uint8_t> withDoubleAt(std::vector<uint8_t> bytes, size_t offset, double value)
+	{
+		std::memcpy(bytes.data() + offset, &value, sizeof(value));
+
+		return bytes;
+	}
+
+
+	TEST_CLASS(TDigestTest)
+	{
+	public:
+		TEST_METHOD(TDigestConstructionIsCorrect)
+		{
+			const Math::TDigest digest;
+
+			Assert::AreEqual(Math::TDigest::defaultCompression, digest.compression());
+			Assert::AreEqual(uint64_t(0), digest.count());
+			Assert::AreEqual(size_t(0), digest.centroidsCount());
+
+			Assert::ExpectException<std::invalid_argument>([]() { Math::TDigest(5.0); });
+		}
+
+
+		TEST_METHOD(TDigestIsAccurate)
+		{
+			const auto values(testValues(200000));
+			Math::TDigest digest;
+
+			digest.push(values);
+
+			Assert::AreEqual(uint64_t(values.size()), digest.count());
+			Assert::AreEqual(*std::min_element(values.begin(), values.end()), digest.min());
+			Assert::AreEqual(*std::max_element(values.begin(), values.end()), digest.max());
+			Assert::IsTrue(digest.centroidsCount() <= size_t(digest.compression()));
+
+			checkAccuracy(digest, values);
+		}
+
+
+		TEST_METHOD(TDigestIsExactWithFewValues)
+		{
+			Math::TDigest digest;
+
+			for (double x : { 3.0, 1.0, 2.0 })
+			{
+				digest.push(x);
+			}
+
+			Assert::AreEqual(1.0, digest.quantile(0.0));
+			Assert::AreEqual(2.0, digest.quantile(0.5));
+			Assert::AreEqual(3.0, digest.quantile(1.0));
+
+			Assert::AreEqual(0.0, digest.cdf(0.5));
+			Assert::AreEqual(0.5, digest.cdf(2.0), 1e-12);
+			Assert::AreEqual(1.0, digest.cdf(3.0));
+		}
+
+
+		TEST_METHOD(TDigestCdfIsInverseOfQuantile)
+		{
+			Math::TDigest digest;
+			digest.push(testValues(50000));
+
+			for (double q : { 0.001, 0.1, 0.5, 0.75, 0.99, 0.999 })
+			{
+				Assert::AreEqual(q, digest.cdf(digest.quantile(q)), 1e-9);
+			}
+		}
+
+
+		TEST_METHOD(TDigestMergeIsAccurate)
+		{
+			const auto values(testValues(200000));
+			std::vector<Math::TDigest> partials(10);
+
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				partials[i % partials.size()].push(values[i]);
+			}
+
+			Math::TDigest merged;
+
+			for (const auto& partial : partials)
+			{
+				merged.merge(partial);
+			}
+
+			Assert::AreEqual(uint64_t(values.size()), merged.count());
+			checkAccuracy(merged, values);
+
+			merged.merge(merged);
+			Assert::AreEqual(uint64_t(2 * values.size()), merged.count());
+			checkAccuracy(merged, values);
+		}
+
+
+		TEST_METHOD(TDigestSerializationRoundTrips)
+		{
+			Math::TDigest digest(100.0);
+			digest.push(testValues(10000));
+
+			const auto restored(Math::TDigest::deserialize(digest.serialize()));
+
+			Assert::AreEqual(digest.compression(), restored.compression());
+			Assert::AreEqual(digest.count(), restored.count());
+			Assert::AreEqual(digest.centroidsCount(), restored.centroidsCount());
+
+			for (double q : { 0.0, 0.01, 0.5, 0.99, 1.0 })
+			{
+				Assert::AreEqual(digest.quantile(q), restored.quantile(q));
+			}
+
+			const auto empty(Math::TDigest::deserialize(Math::TDigest().serialize()));
+			Assert::AreEqual(uint64_t(0), empty.count());
+		}
+
+
+		TEST_METHOD(TDigestThrowsOnInvalidInput)
+		{
+			Math::TDigest digest;
+
+			Assert::ExpectException<std::domain_error>([&digest]() { digest.quantile(0.5); });
+			Assert::ExpectException<std::domain_error>([&digest]() { digest.cdf(0.5); });
+			Assert::ExpectException<std::domain_error>([&digest]() { digest.min(); });
+			Assert::ExpectException<std::invalid_argument>([&digest]() { digest.push(std::nan("")); });
+
+			digest.push(1.0);
+
+			Assert::ExpectException<std::invalid_argument>([&digest]() { digest.quantile(-0.1); });
+			Assert::ExpectException<std::invalid_argument>([&digest]() { digest.quantile(1.1); });
+
+			auto bytes(digest.serialize());
+
+			Assert::ExpectException<std::invalid_argument>([]() { Math::TDigest::deserialize(std::vector<uint8_t>(10, 0)); });
+			Assert::ExpectException<std::invalid_argument>([&bytes]() { Math::TDigest::deserialize(std::vector<uint8_t>(bytes.begin(), bytes.end() - 1)); });
+
+			// Header: magic (4 bytes), compression, count, min, max, number of centroids. Then (mean, weight) pairs.
+			for (double compression : { std::numeric_limits<double>::infinity(), std::nan(""), 1e300, Math::TDigest::maxCompression * 2.0, 5.0 })
+			{
+				Assert::ExpectException<std::invalid_argument>([compression]() { Math::TDigest tooLarge(compression); });
+				Assert::ExpectException<std::invalid_argument>([&bytes, compression]() { Math::TDigest::deserialize(withDoubleAt(bytes, 4, compression)); });
+			}
+
+			Assert::ExpectException<std::invalid_argument>([&bytes]() { Math::TDigest::deserialize(withDoubleAt(bytes, 52, 2.0)); });
+			Assert::AreEqual(uint64_t(1), Math::TDigest::deserialize(withDoubleAt(bytes, 52, 1.0)).count());
+
+			bytes[0] = 'X';
+			Assert::ExpectException<std::invalid_argument>([&bytes]() { Math::TDigest::deserialize(bytes); });
+		}
+	};
+}
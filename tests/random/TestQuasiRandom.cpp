@@ -0,0 +1,229 @@
+#define NOMINMAX
+
+#include "CppUnitTest.h"
+
+#include <shlublu/random/QuasiRandom.h>
+#include <shlublu/util/Debug.h>
+SHLUBLU_OPTIMIZE_OFF();
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace shlublu;
+
+namespace random_QuasiRandom
+{
+	static void checkSequenceConsistency(QuasiRandomSequence& seq)
+	{
+		constexpr size_t nbPoints(1000);
+
+		const auto batch(seq.generate(nbPoints));
+		Assert::AreEqual(nbPoints * seq.dimensions(), batch.size());
+		Assert::AreEqual(nbPoints, seq.index());
+
+		seq.seek(0);
+
+		for (size_t i = 0; i < nbPoints; ++i)
+		{
+			Assert::IsTrue(seq.next());
+
+			for (size_t d = 0; d < seq.dimensions(); ++d)
+			{
+				Assert::AreEqual(batch[i * seq.dimensions() + d], seq.point()[d]);
+				Assert::IsTrue(seq.point()[d] >= 0.0 && seq.point()[d] < 1.0);
+			}
+		}
+
+		seq.seek(737);
+		Assert::IsTrue(seq.next());
+
+		for (size_t d = 0; d < seq.dimensions(); ++d)
+		{
+			Assert::AreEqual(batch[737 * seq.dimensions() + d], seq.point()[d]);
+		}
+
+		seq.skip(100);
+		Assert::AreEqual(size_t(838), seq.index());
+	}
+
+
+	static double integrateProduct(QuasiRandomSequence& seq, size_t nbPoints)
+	{
+		const auto points(seq.generate(nbPoints));
+		double sum(0.0);
+
+		for (size_t i = 0; i < nbPoints; ++i)
+		{
+			double product(1.0);
+
+			for (size_t d = 0; d < seq.dimensions(); ++d)
+			{
+				product *= points[i * seq.dimensions() + d];
+			}
+
+			sum += product;
+		}
+
+		return sum / double(nbPoints);
+	}
+
+
+	TEST_CLASS(SobolSequenceTest)
+	{
+	public:
+		TEST_METHOD(SobolSequenceConstructionIsCorrect)
+		{
+			const SobolSequence sobol(3);
+
+			Assert::AreEqual(size_t(3), sobol.dimensions());
+			Assert::AreEqual(size_t(0), sobol.index());
+			Assert::IsTrue(sobol.point().empty());
+		}
+
+
+		TEST_METHOD(SobolSequenceConstructionThrowsIfDimensionsAreOutOfRange)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { SobolSequence(0); });
+			Assert::ExpectException<std::invalid_argument>([]() { SobolSequence(SobolSequence::maxDimensions + 1); });
+		}
+
+
+		TEST_METHOD(SobolSequenceGivesExpectedPoints)
+		{
+			SobolSequence sobol(2);
+
+			const std::vector<std::vector<double>> expected
+			{
+				{ 0.0, 0.0 }, { 0.5, 0.5 }, { 0.75, 0.25 }, { 0.25, 0.75 }, { 0.375, 0.375 }, { 0.875, 0.875 }, { 0.625, 0.125 }, { 0.125, 0.625 }
+			};
+
+			for (const auto& point : expected)
+			{
+				Assert::IsTrue(sobol.next());
+				Assert::IsTrue(point == sobol.point());
+			}
+		}
+
+
+		TEST_METHOD(SobolSequenceIsConsistent)
+		{
+			SobolSequence sobol(SobolSequence::maxDimensions);
+			checkSequenceConsistency(sobol);
+
+			SobolSequence scrambled(SobolSequence::maxDimensions, true);
+			checkSequenceConsistency(scrambled);
+		}
+
+
+		TEST_METHOD(SobolSequenceIntegratesAccurately)
+		{
+			SobolSequence sobol(4);
+			Assert::AreEqual(1.0 / 16.0, integrateProduct(sobol, 4096), 1e-3);
+
+			SobolSequence scrambled(4, true);
+			Assert::AreEqual(1.0 / 16.0, integrateProduct(scrambled, 4096), 1e-3);
+		}
+
+
+		TEST_METHOD(SobolSequenceThrowsIfSeekingOutOfRange)
+		{
+			SobolSequence sobol(2);
+			sobol.seek(sobol.size());
+
+			Assert::IsFalse(sobol.next());
+			Assert::ExpectException<std::out_of_range>([&sobol]() { sobol.skip(1); });
+		}
+	};
+
+
+	TEST_CLASS(HaltonSequenceTest)
+	{
+	public:
+		TEST_METHOD(HaltonSequenceConstructionThrowsIfNoDimensions)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { HaltonSequence(0); });
+		}
+
+
+		TEST_METHOD(HaltonSequenceGivesExpectedPoints)
+		{
+			HaltonSequence halton(2);
+
+			const std::vector<std::vector<double>> expected
+			{
+				{ 0.0, 0.0 }, { 1.0 / 2.0, 1.0 / 3.0 }, { 1.0 / 4.0, 2.0 / 3.0 }, { 3.0 / 4.0, 1.0 / 9.0 }, { 1.0 / 8.0, 4.0 / 9.0 }
+			};
+
+			for (const auto& point : expected)
+			{
+				Assert::IsTrue(halton.next());
+				Assert::AreEqual(point[0], halton.point()[0], 1e-15);
+				Assert::AreEqual(point[1], halton.point()[1], 1e-15);
+			}
+		}
+
+
+		TEST_METHOD(HaltonSequenceIsConsistent)
+		{
+			HaltonSequence halton(30);
+			checkSequenceConsistency(halton);
+
+			HaltonSequence scrambled(30, true);
+			checkSequenceConsistency(scrambled);
+		}
+
+
+		TEST_METHOD(HaltonSequenceIntegratesAccurately)
+		{
+			HaltonSequence halton(4);
+			Assert::AreEqual(1.0 / 16.0, integrateProduct(halton, 4096), 1e-3);
+
+			HaltonSequence scrambled(4, true);
+			Assert::AreEqual(1.0 / 16.0, integrateProduct(scrambled, 4096), 1e-3);
+		}
+	};
+
+
+	TEST_CLASS(R2SequenceTest)
+	{
+	public:
+		TEST_METHOD(R2SequenceConstructionThrowsIfNoDimensions)
+		{
+			Assert::ExpectException<std::invalid_argument>([]() { R2Sequence(0); });
+		}
+
+
+		TEST_METHOD(R2SequenceGivesExpectedPoints)
+		{
+			R2Sequence r2(1);
+			const double goldenRatio((1.0 + std::sqrt(5.0)) / 2.0);
+
+			for (size_t i = 0; i < 10; ++i)
+			{
+				double dummy;
+
+				Assert::IsTrue(r2.next());
+				Assert::AreEqual(std::modf(0.5 + double(i) / goldenRatio, &dummy), r2.point()[0], 1e-12);
+			}
+		}
+
+
+		TEST_METHOD(R2SequenceIsConsistent)
+		{
+			R2Sequence r2(50);
+			checkSequenceConsistency(r2);
+
+			R2Sequence scrambled(50, true);
+			checkSequenceConsistency(scrambled);
+		}
+
+
+		TEST_METHOD(R2SequenceIntegratesAccurately)
+		{
+			R2Sequence r2(4);
+			Assert::AreEqual(1.0 / 16.0, integrateProduct(r2, 4096), 1e-3);
+
+			R2Sequence scrambled(4, true);
+			Assert::AreEqual(1.0 / 16.0, integrateProduct(scrambled, 4096), 1e-3);
+		}
+	};
+}